@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+#
+# Repository:  https://github.com/kingkybel/TypeTraits
+# File Name:   bench/compile/module_compile_bench.py
+# Description: Build-time comparison of including include/traits.h against importing the dkyb.traits module.
+#
+# Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+#
+# @date: 2026-10-17
+# @author: Dieter J Kybelksties
+"""
+Generate a synthetic project of many small translation units that use the traits, and build it twice: once with
+every TU including traits.h and traits_static.h, once with every TU importing the prebuilt dkyb.traits module. The
+module build includes the time to build the module itself. Wall time of the whole build and CPU time summed over all
+compiler processes are written to a JSON report.
+
+The TUs use nothing but the traits, so that the difference is the cost of the headers; standard headers a real TU
+would include anyway are added to both builds with --std-include.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import subprocess
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+HEADER_PROLOGUE = """\
+#include "traits.h"
+#include "traits_static.h"
+"""
+
+MODULE_PROLOGUE = """\
+import dkyb.traits;
+"""
+
+
+def generate_tu(index: int, prologue: str, std_includes: list[str]) -> str:
+    includes = "".join(f"#include <{header}>\n" for header in std_includes)
+    return includes + prologue + f"""
+namespace tu{index}
+{{
+struct record
+{{
+    char const* name;
+    int         id;
+
+    bool valid() const noexcept
+    {{
+        return id != 0;
+    }}
+}};
+
+constexpr auto valid_probe = []<typename T>(auto& target) -> decltype(target = &T::valid) {{ return target; }};
+
+static_assert(util::is_string_v<char const*>);
+static_assert(!util::is_string_v<record>);
+static_assert(util::is_compatible_string_v<char const*, char[{index + 2}]>);
+static_assert(util::is_equality_comparable_v<int, long>);
+static_assert(util::index_of_type_v<record, int, record, char> == 1);
+static_assert(util::has_member_function_c<record, bool() const, valid_probe>);
+
+util::get_Nth_type_t<1, char, record> make_record(char const* name)
+{{
+    return {{name, static_cast<int>(util::as_string_view(name).size()) + {index}}};
+}}
+}} // namespace tu{index}
+"""
+
+
+def compiler_kind(compiler: str) -> str:
+    macros = subprocess.run([compiler, "-x", "c++", "-dM", "-E", os.devnull],
+                            capture_output=True, text=True).stdout
+    if "__clang__" in macros:
+        return "clang"
+    if "__GNUC__" in macros:
+        return "gcc"
+    return "unknown"
+
+
+def run(cmd: list[str], cwd: Path) -> float:
+    """Run the compiler once and return its CPU seconds (user and system)."""
+    proc = subprocess.Popen(cmd, cwd=cwd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    stderr = proc.stderr.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    if os.waitstatus_to_exitcode(status) != 0:
+        raise RuntimeError(f"compilation failed: {' '.join(cmd)}\n{stderr}")
+    return usage.ru_utime + usage.ru_stime
+
+
+def module_commands(kind: str, args, build_dir: Path) -> tuple[list[list[str]], list[str]]:
+    """Commands that build the module, and the flags that make it importable."""
+    base = [args.compiler, f"-std={args.std}", f"-I{args.include_dir}"] + args.extra_flag
+    if kind == "gcc":
+        # the module is written to gcm.cache/ of the working directory, where the importers look for it
+        return [base + ["-fmodules-ts", "-x", "c++", "-c", str(args.module_source), "-o", "dkyb.traits.o"]], [
+            "-fmodules-ts"]
+    if kind == "clang":
+        pcm = build_dir / "dkyb.traits.pcm"
+        return [base + ["-x", "c++-module", "--precompile", str(args.module_source), "-o", str(pcm)],
+                base + ["-c", str(pcm), "-o", "dkyb.traits.o"]], [f"-fmodule-file=dkyb.traits={pcm}"]
+    raise RuntimeError("the module build is only driven for GCC and clang")
+
+
+def build(mode: str, kind: str, args) -> dict:
+    build_dir = (args.work_dir / mode).resolve()
+    build_dir.mkdir(parents=True, exist_ok=True)
+    prologue = MODULE_PROLOGUE if mode == "module" else HEADER_PROLOGUE
+    sources = []
+    for index in range(args.tus):
+        source = build_dir / f"tu{index}.cc"
+        source.write_text(generate_tu(index, prologue, args.std_include))
+        sources.append(source)
+
+    start = time.perf_counter()
+    cpu = 0.0
+    module_seconds = None
+    flags = []
+    if mode == "module":
+        commands, flags = module_commands(kind, args, build_dir)
+        for cmd in commands:
+            cpu += run(cmd, build_dir)
+        module_seconds = time.perf_counter() - start
+
+    base = [args.compiler, f"-std={args.std}", f"-I{args.include_dir}"] + flags + args.extra_flag
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        cpu += sum(pool.map(lambda source: run(base + ["-c", source.name, "-o", source.stem + ".o"], build_dir),
+                            sources))
+    wall = time.perf_counter() - start
+
+    return {"wall_seconds": wall, "cpu_seconds": cpu, "module_seconds": module_seconds}
+
+
+def main() -> int:
+    repository = Path(__file__).resolve().parents[2]
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--std", default="c++23")
+    parser.add_argument("--include-dir", type=Path, default=repository / "include")
+    parser.add_argument("--module-source", type=Path, default=repository / "modules" / "dkyb.traits.cppm")
+    parser.add_argument("--work-dir", type=Path, default=Path("module_compile_bench"))
+    parser.add_argument("--report", type=Path, default=Path("module_compile_bench.json"))
+    parser.add_argument("--tus", type=int, default=500, help="number of translation units")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1, help="parallel compilations")
+    parser.add_argument("--std-include", action="append", default=[], help="standard header every TU includes")
+    parser.add_argument("--extra-flag", action="append", default=[], help="additional compiler flag")
+    parser.add_argument("--mode", choices=("both", "header", "module"), default="both")
+    args = parser.parse_args()
+
+    kind = compiler_kind(args.compiler)
+    modes = ("header", "module") if args.mode == "both" else (args.mode,)
+    report = {
+        "context": {
+            "date": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+            "host": platform.node(),
+            "compiler": args.compiler,
+            "std": args.std,
+            "extra_flags": args.extra_flag,
+            "std_includes": args.std_include,
+            "tus": args.tus,
+            "jobs": args.jobs,
+        },
+        "builds": {},
+    }
+    for mode in modes:
+        result = build(mode, kind, args)
+        report["builds"][mode] = result
+        print(f"{mode:<8}{result['wall_seconds']:>10.2f} s wall{result['cpu_seconds']:>10.2f} s cpu")
+
+    if len(modes) == 2:
+        header, module = report["builds"]["header"], report["builds"]["module"]
+        report["cpu_speedup"] = header["cpu_seconds"] / module["cpu_seconds"]
+        print(f"module build needs {100.0 / report['cpu_speedup']:.0f}% of the CPU time of the header build")
+
+    args.report.write_text(json.dumps(report, indent=2) + "\n")
+    print(f"report written to {args.report}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
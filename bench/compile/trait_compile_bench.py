@@ -0,0 +1,426 @@
+#!/usr/bin/env python3
+#
+# Repository:  https://github.com/kingkybel/TypeTraits
+# File Name:   bench/compile/trait_compile_bench.py
+# Description: Compile-time benchmark for the traits in include/traits.h, include/traits_static.h and
+#              include/type_list.h.
+#
+# Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+#
+# @date: 2026-10-17
+# @author: Dieter J Kybelksties
+"""
+Generate one translation unit per trait that instantiates the trait over thousands of synthetic types, compile each
+TU and record wall time, peak RSS and (where the compiler can report it) template instantiation counts in a JSON
+report.
+
+Instantiation counts come from clang's -ftime-trace; with GCC the time spent in template instantiation is taken from
+-ftime-report instead. A previous report can be passed with --compare to flag front-end cost regressions.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Callable
+
+
+PRELUDE = """\
+#include "traits.h"
+#include "traits_static.h"
+#include "type_list.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace bench
+{
+struct WithFill
+{
+    bool fill()
+    {
+        return true;
+    }
+
+    static bool static_fill()
+    {
+        return true;
+    }
+};
+
+struct WithoutFill
+{
+};
+
+// distinct class types; every second one has member functions the DEFINE_HAS_* traits look for
+template <std::size_t I> struct Synth : std::conditional_t<I % 2 == 0, WithFill, WithoutFill>
+{
+};
+
+// distinct std::basic_string instantiations
+template <typename CharT, std::size_t I> struct SynthAlloc : std::allocator<CharT>
+{
+    template <typename U> struct rebind
+    {
+        using other = SynthAlloc<U, I>;
+    };
+};
+
+template <std::size_t I> using SynthString = std::basic_string<char, std::char_traits<char>, SynthAlloc<char, I>>;
+
+// cycle through every kind is_string distinguishes so that no lookup is memoised by an earlier one
+template <std::size_t I> struct SynthKind;
+template <std::size_t I> requires(I % 5 == 0) struct SynthKind<I> { using type = Synth<I>; };
+template <std::size_t I> requires(I % 5 == 1) struct SynthKind<I> { using type = SynthString<I>; };
+template <std::size_t I> requires(I % 5 == 2) struct SynthKind<I> { using type = char const[I + 1]; };
+template <std::size_t I> requires(I % 5 == 3) struct SynthKind<I> { using type = wchar_t[I + 1]; };
+template <std::size_t I> requires(I % 5 == 4) struct SynthKind<I> { using type = Synth<I>*; };
+template <std::size_t I> using SynthKind_t = typename SynthKind<I>::type;
+
+// distinct types of sizes 1 to 7
+template <std::size_t I> struct SynthSized
+{
+    char data[I % 7 + 1];
+};
+} // namespace bench
+
+"""
+
+
+def _expand(body: str, n: int) -> str:
+    """Wrap a pack-expansion expression over Is... in a function evaluated for I = 0..n-1."""
+    return PRELUDE + f"""\
+namespace bench
+{{
+template <std::size_t... Is> constexpr std::size_t run(std::index_sequence<Is...>)
+{{
+    constexpr bool results[] = {{false, ({body})...}};
+    return sizeof(results);
+}}
+
+static_assert(run(std::make_index_sequence<{n}>{{}}) == {n + 1});
+}} // namespace bench
+"""
+
+
+MACRO_DEFINITIONS = {
+    "DEFINE_HAS_STATIC_MEMBER_FUNCTION":
+        ("DEFINE_HAS_STATIC_MEMBER_FUNCTION(has_static_fill, T::static_fill, bool (*)(void))", "has_static_fill_v"),
+    "DEFINE_HAS_MEMBER_FUNCTION":
+        ("DEFINE_HAS_MEMBER_FUNCTION(has_fill, fill, bool (T::*)(void))", "has_fill_v"),
+    "DEFINE_HAS_STATIC_MEMBER_CONCEPT":
+        ("DEFINE_HAS_STATIC_MEMBER_CONCEPT(has_static_fill, static_fill, bool())", "has_static_fill"),
+    "DEFINE_HAS_MEMBER_CONCEPT":
+        ("DEFINE_HAS_MEMBER_CONCEPT(has_fill, fill, bool())", "has_fill"),
+}
+
+
+def _macro_case(n: int, macro: str) -> str:
+    definition, trait = MACRO_DEFINITIONS[macro]
+    source = _expand(f"{trait}<Synth<Is>>", n)
+    return source.replace("namespace bench\n{\ntemplate <std::size_t... Is>",
+                          f"namespace bench\n{{\n{definition}\n\ntemplate <std::size_t... Is>", 1)
+
+
+# Hand-rolled recursive versions of type_list_unique and type_list_filter, as reference for the constant-depth ones.
+RECURSIVE_LIST_ALGORITHMS = """\
+namespace bench
+{
+template <typename T, typename List> struct prepend;
+template <typename T, typename... Ts> struct prepend<T, util::type_list<Ts...>>
+{
+    using type = util::type_list<T, Ts...>;
+};
+
+template <typename List> struct recursive_unique
+{
+    using type = util::type_list<>;
+};
+template <typename T, typename... Ts> struct recursive_unique<util::type_list<T, Ts...>>
+{
+    using rest = typename recursive_unique<util::type_list<Ts...>>::type;
+    using type = std::conditional_t<(std::is_same_v<T, Ts> || ...), rest, typename prepend<T, rest>::type>;
+};
+
+template <typename List, template <typename> class Pred> struct recursive_filter
+{
+    using type = util::type_list<>;
+};
+template <typename T, typename... Ts, template <typename> class Pred>
+struct recursive_filter<util::type_list<T, Ts...>, Pred>
+{
+    using rest = typename recursive_filter<util::type_list<Ts...>, Pred>::type;
+    using type = std::conditional_t<Pred<T>::value, typename prepend<T, rest>::type, rest>;
+};
+} // namespace bench
+
+"""
+
+
+def _list_case(expression: str, n: int, recursive: bool = False) -> str:
+    """Apply a type-list algorithm once to a list of n distinct types of different sizes."""
+    return PRELUDE + (RECURSIVE_LIST_ALGORITHMS if recursive else "") + f"""\
+namespace bench
+{{
+template <typename T> struct is_odd_sized : std::bool_constant<sizeof(T) % 2 == 1>
+{{
+}};
+
+template <std::size_t... Is> auto make_list(std::index_sequence<Is...>) -> util::type_list<SynthSized<Is>...>;
+template <std::size_t... Is> auto make_pairs(std::index_sequence<Is...>) -> util::type_list<SynthSized<Is / 2>...>;
+
+using list = decltype(make_list(std::make_index_sequence<{n}>{{}}));
+
+// every type twice
+using paired_list = decltype(make_pairs(std::make_index_sequence<{n}>{{}}));
+
+template <typename... Ts> auto concat_singletons(util::type_list<Ts...>) -> util::type_list_concat_t<util::type_list<Ts>...>;
+
+using result = {expression};
+static_assert(result::size <= {n});
+}} // namespace bench
+"""
+
+
+@dataclass
+class Case:
+    name: str
+    description: str
+    generate: Callable[[int], str]
+    flags: tuple[str, ...] = ()
+
+
+CASES = [
+    Case("baseline", "synthetic types only, no trait instantiated",
+         lambda n: _expand("!std::is_void_v<SynthKind_t<Is>>", n)),
+    Case("is_string", "util::is_string over all string kinds",
+         lambda n: _expand("util::is_string_v<SynthKind_t<Is>>", n)),
+    Case("is_compatible_string", "util::is_compatible_string against std::string",
+         lambda n: _expand("util::is_compatible_string_v<SynthKind_t<Is>, std::string>", n)),
+    Case("has_std_string_compatible_char", "util::has_std_string_compatible_char against char",
+         lambda n: _expand("util::has_std_string_compatible_char_v<SynthKind_t<Is>, char>", n)),
+    Case("has_std_hash", "util::has_std_hash over class and string types",
+         lambda n: _expand("util::has_std_hash_v<SynthKind_t<Is>>", n)),
+    Case("get_Nth_type", "util::get_Nth_type_t of every index of an n-element pack",
+         lambda n: _expand(f"std::is_same_v<util::get_Nth_type_t<Is, Synth<Is>...>, Synth<Is>>", n)),
+    Case("index_of_type", "util::index_of_type_v of every element of an n-element pack",
+         lambda n: _expand("util::index_of_type_v<Synth<Is>, Synth<Is>...> == Is", n)),
+    Case("type_list_contains", "util::type_list::contains of every element of an n-element list",
+         lambda n: _expand("util::type_list<Synth<Is>...>::template contains<Synth<Is>>", n)),
+    Case("type_list_index_of", "util::type_list::index_of of every element of an n-element list",
+         lambda n: _expand("util::type_list<Synth<Is>...>::template index_of<Synth<Is>> == Is", n)),
+    Case("type_list_concat", "util::type_list_concat_t of n one-element lists",
+         lambda n: _list_case("decltype(concat_singletons(list{}))", n)),
+    Case("type_list_transform", "util::type_list_transform_t of an n-element list",
+         lambda n: _list_case("util::type_list_transform_t<list, std::add_pointer_t>", n)),
+    Case("type_list_filter", "util::type_list_filter_t of an n-element list",
+         lambda n: _list_case("util::type_list_filter_t<list, is_odd_sized>", n)),
+    Case("type_list_filter_recursive", "hand-rolled recursive filter of an n-element list, for reference",
+         lambda n: _list_case("recursive_filter<list, is_odd_sized>::type", n, recursive=True),
+         ("-ftemplate-depth=100000",)),
+    Case("type_list_unique", "util::type_list_unique_t of an n-element list of distinct types",
+         lambda n: _list_case("util::type_list_unique_t<list>", n)),
+    Case("type_list_unique_pairs", "util::type_list_unique_t of an n-element list holding each type twice",
+         lambda n: _list_case("util::type_list_unique_t<paired_list>", n)),
+    Case("type_list_unique_recursive", "hand-rolled recursive unique of an n-element list, for reference",
+         lambda n: _list_case("recursive_unique<list>::type", n, recursive=True),
+         ("-ftemplate-depth=100000",)),
+    Case("type_list_sort_by", "util::type_list_sort_by_t of an n-element list by size",
+         lambda n: _list_case("util::type_list_sort_by_t<list, util::size_of>", n)),
+    Case("DEFINE_HAS_MEMBER_FUNCTION", "trait generated by DEFINE_HAS_MEMBER_FUNCTION",
+         lambda n: _macro_case(n, "DEFINE_HAS_MEMBER_FUNCTION")),
+    Case("DEFINE_HAS_STATIC_MEMBER_FUNCTION", "trait generated by DEFINE_HAS_STATIC_MEMBER_FUNCTION",
+         lambda n: _macro_case(n, "DEFINE_HAS_STATIC_MEMBER_FUNCTION")),
+    Case("DEFINE_HAS_MEMBER_CONCEPT", "concept generated by DEFINE_HAS_MEMBER_CONCEPT",
+         lambda n: _macro_case(n, "DEFINE_HAS_MEMBER_CONCEPT")),
+    Case("DEFINE_HAS_STATIC_MEMBER_CONCEPT", "concept generated by DEFINE_HAS_STATIC_MEMBER_CONCEPT",
+         lambda n: _macro_case(n, "DEFINE_HAS_STATIC_MEMBER_CONCEPT")),
+]
+
+
+def compiler_identity(compiler: str) -> tuple[str, str]:
+    """Return the compiler family ('clang', 'gcc' or 'unknown') and its version banner."""
+    version = subprocess.run([compiler, "--version"], capture_output=True, text=True, check=True).stdout
+    macros = subprocess.run([compiler, "-x", "c++", "-dM", "-E", os.devnull],
+                            capture_output=True, text=True).stdout
+    if "__clang__" in macros:
+        kind = "clang"
+    elif "__GNUC__" in macros:
+        kind = "gcc"
+    else:
+        kind = "unknown"
+    return kind, version.splitlines()[0] if version else compiler
+
+
+def count_instantiations(trace_file: Path) -> dict:
+    """Count InstantiateClass/InstantiateFunction events in a clang -ftime-trace file."""
+    counts = {"class": 0, "function": 0}
+    if not trace_file.exists():
+        return counts
+    with trace_file.open() as f:
+        events = json.load(f).get("traceEvents", [])
+    for event in events:
+        if event.get("ph") != "X":
+            continue
+        if event.get("name") == "InstantiateClass":
+            counts["class"] += 1
+        elif event.get("name") == "InstantiateFunction":
+            counts["function"] += 1
+    return counts
+
+
+def gcc_instantiation_seconds(stderr: str):
+    """Wall time of the 'template instantiation' phase from GCC's -ftime-report."""
+    for line in stderr.splitlines():
+        if line.strip().startswith("template instantiation"):
+            # columns are usr, sys, wall, each followed by a percentage
+            timings = re.findall(r"(\d+\.\d+)\s*\(\s*\d+%\)", line)
+            return float(timings[2]) if len(timings) >= 3 else None
+    return None
+
+
+def compile_once(cmd: list[str]) -> tuple[float, int, str]:
+    """Run the compiler once and return (wall seconds, peak RSS in KiB, stderr)."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    stderr = proc.stderr.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.perf_counter() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+        raise RuntimeError(f"compilation failed: {' '.join(cmd)}\n{stderr}")
+    # ru_maxrss is in KiB on Linux and bytes on macOS
+    peak_rss_kib = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    return wall, peak_rss_kib, stderr
+
+
+def run_case(case: Case, n: int, args, kind: str) -> dict:
+    stem = f"{case.name}_{n}"
+    source = args.work_dir / f"{stem}.cc"
+    obj = args.work_dir / f"{stem}.o"
+    source.write_text(case.generate(n))
+    cmd = [args.compiler, f"-std={args.std}", f"-I{args.include_dir}", "-c", str(source), "-o", str(obj)]
+    cmd += list(case.flags) + args.extra_flag
+    if kind == "clang":
+        cmd += ["-ftime-trace", "-ftime-trace-granularity=0"]
+    elif kind == "gcc":
+        cmd += ["-ftime-report"]
+
+    walls, rss, stderr = [], [], ""
+    for _ in range(args.repetitions):
+        wall, peak, stderr = compile_once(cmd)
+        walls.append(wall)
+        rss.append(peak)
+
+    result = {
+        "name": stem,
+        "case": case.name,
+        "description": case.description,
+        "types": n,
+        "wall_seconds": min(walls),
+        "wall_seconds_all": walls,
+        "peak_rss_kib": max(rss),
+        "instantiations": None,
+        "instantiation_seconds": None,
+    }
+    if kind == "clang":
+        result["instantiations"] = count_instantiations(obj.with_suffix(".json"))
+    elif kind == "gcc":
+        result["instantiation_seconds"] = gcc_instantiation_seconds(stderr)
+    return result
+
+
+def compare(report: dict, previous_file: Path, threshold_pct: float) -> int:
+    previous = {b["name"]: b for b in json.loads(previous_file.read_text())["benchmarks"]}
+    regressions = 0
+    print(f"\n{'benchmark':<48}{'wall':>10}{'rss':>10}")
+    for bench in report["benchmarks"]:
+        old = previous.get(bench["name"])
+        if old is None:
+            continue
+        wall_pct = 100.0 * (bench["wall_seconds"] - old["wall_seconds"]) / old["wall_seconds"]
+        rss_pct = 100.0 * (bench["peak_rss_kib"] - old["peak_rss_kib"]) / old["peak_rss_kib"]
+        flag = ""
+        if wall_pct > threshold_pct or rss_pct > threshold_pct:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{bench['name']:<48}{wall_pct:>+9.1f}%{rss_pct:>+9.1f}%{flag}")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--std", default="c++23")
+    parser.add_argument("--include-dir", type=Path, default=Path(__file__).resolve().parents[2] / "include")
+    parser.add_argument("--work-dir", type=Path, default=Path("trait_compile_bench"))
+    parser.add_argument("--report", type=Path, default=Path("trait_compile_bench.json"))
+    parser.add_argument("--types", default="2000", help="comma separated numbers of synthetic types per TU")
+    parser.add_argument("--repetitions", type=int, default=3, help="compilations per TU, the fastest one counts")
+    parser.add_argument("--filter", default=".*", help="regular expression selecting cases by name")
+    parser.add_argument("--extra-flag", action="append", default=[], help="additional compiler flag")
+    parser.add_argument("--compare", type=Path, help="previous report to compare against")
+    parser.add_argument("--threshold", type=float, default=10.0, help="regression threshold in percent")
+    parser.add_argument("--list", action="store_true", help="list the cases and exit")
+    args = parser.parse_args()
+
+    if args.list:
+        for case in CASES:
+            print(f"{case.name:<40}{case.description}")
+        return 0
+
+    args.work_dir.mkdir(parents=True, exist_ok=True)
+    kind, version = compiler_identity(args.compiler)
+    selected = [case for case in CASES if re.search(args.filter, case.name)]
+    sizes = [int(n) for n in args.types.split(",")]
+
+    report = {
+        "context": {
+            "date": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+            "host": platform.node(),
+            "compiler": args.compiler,
+            "compiler_version": version,
+            "std": args.std,
+            "extra_flags": args.extra_flag,
+            "repetitions": args.repetitions,
+        },
+        "benchmarks": [],
+    }
+    for case in selected:
+        for n in sizes:
+            result = run_case(case, n, args, kind)
+            report["benchmarks"].append(result)
+            print(f"{result['name']:<48}{result['wall_seconds']:>8.3f} s{result['peak_rss_kib'] / 1024:>10.1f} MiB")
+
+    args.report.write_text(json.dumps(report, indent=2) + "\n")
+    print(f"report written to {args.report}")
+
+    if args.compare:
+        return 1 if compare(report, args.compare, args.threshold) else 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
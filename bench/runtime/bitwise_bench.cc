@@ -0,0 +1,165 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/bitwise_bench.cc
+ * Description: equality of arrays of plain records: field by field with the defaulted operator== against fast_equal;
+ *              hashing of plain keys: per-member hash_combine against byte_hash and hash_many.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bitwise.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace
+{
+struct flow_record
+{
+    using bitwise_equality_comparable = std::true_type;
+
+    std::uint32_t source;
+    std::uint32_t destination;
+    std::uint16_t source_port;
+    std::uint16_t destination_port;
+    std::uint32_t protocol;
+    std::uint64_t bytes;
+
+    bool operator==(flow_record const&) const = default;
+};
+
+/**
+ * @brief Two equal arrays of state.range(0) records, so that every comparison runs to the end.
+ */
+std::vector<flow_record> make_records(size_t count)
+{
+    std::vector<flow_record> records(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto const value = static_cast<std::uint32_t>(index * 2'654'435'761U);
+        records[index]   = {value, value ^ 0xffffU, static_cast<std::uint16_t>(value), 443, 6, index * 1500};
+    }
+    return records;
+}
+
+void BM_defaulted_equal(benchmark::State& state)
+{
+    auto const lhs = make_records(static_cast<size_t>(state.range(0)));
+    auto const rhs = lhs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * lhs.size() * sizeof(flow_record)));
+}
+
+void BM_fast_equal(benchmark::State& state)
+{
+    auto const lhs = make_records(static_cast<size_t>(state.range(0)));
+    auto const rhs = lhs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(util::fast_equal(std::span{lhs}, std::span{rhs}));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * lhs.size() * sizeof(flow_record)));
+}
+
+BENCHMARK(BM_defaulted_equal)->Name("record_equal/defaulted")->RangeMultiplier(8)->Range(1, 1 << 16);
+BENCHMARK(BM_fast_equal)->Name("record_equal/fast_equal")->RangeMultiplier(8)->Range(1, 1 << 16);
+
+struct flow_key
+{
+    std::uint32_t source;
+    std::uint32_t destination;
+    std::uint16_t source_port;
+    std::uint16_t destination_port;
+    std::uint32_t protocol;
+
+    bool operator==(flow_key const&) const = default;
+};
+
+// the hand-written hasher that byte_hash replaces
+struct hash_combine_flow_key
+{
+    static void combine(size_t& seed, size_t hash) noexcept
+    {
+        seed ^= hash + 0x9e37'79b9 + (seed << 6) + (seed >> 2);
+    }
+
+    size_t operator()(flow_key const& key) const noexcept
+    {
+        size_t seed = 0;
+        combine(seed, std::hash<std::uint32_t>{}(key.source));
+        combine(seed, std::hash<std::uint32_t>{}(key.destination));
+        combine(seed, std::hash<std::uint16_t>{}(key.source_port));
+        combine(seed, std::hash<std::uint16_t>{}(key.destination_port));
+        combine(seed, std::hash<std::uint32_t>{}(key.protocol));
+        return seed;
+    }
+};
+
+std::vector<flow_key> make_keys(size_t count)
+{
+    std::vector<flow_key> keys(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto const value = static_cast<std::uint32_t>(index * 2'654'435'761U);
+        keys[index]      = {value, ~value, static_cast<std::uint16_t>(index), 443, 6};
+    }
+    return keys;
+}
+
+template <typename Hash> void BM_hash_each(benchmark::State& state)
+{
+    auto const          keys = make_keys(static_cast<size_t>(state.range(0)));
+    std::vector<size_t> hashes(keys.size());
+    for (auto _ : state)
+    {
+        for (size_t index = 0; index < keys.size(); ++index)
+        {
+            hashes[index] = Hash{}(keys[index]);
+        }
+        benchmark::DoNotOptimize(hashes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+
+void BM_hash_many(benchmark::State& state)
+{
+    auto const          keys = make_keys(static_cast<size_t>(state.range(0)));
+    std::vector<size_t> hashes(keys.size());
+    for (auto _ : state)
+    {
+        util::hash_many(std::span{keys}, std::span{hashes});
+        benchmark::DoNotOptimize(hashes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+
+BENCHMARK(BM_hash_each<hash_combine_flow_key>)->Name("flow_key_hash/hash_combine")->Range(256, 1 << 16);
+BENCHMARK(BM_hash_each<util::byte_hash<flow_key>>)->Name("flow_key_hash/byte_hash")->Range(256, 1 << 16);
+BENCHMARK(BM_hash_many)->Name("flow_key_hash/hash_many")->Range(256, 1 << 16);
+} // namespace
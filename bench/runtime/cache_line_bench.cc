@@ -0,0 +1,84 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/cache_line_bench.cc
+ * Description: benchmarks of per-thread counters sharing cache lines against padded ones.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "cache_line.h"
+
+#include <array>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace
+{
+constexpr size_t max_threads              = 8;
+constexpr size_t increments_per_iteration = 1024;
+
+/**
+ * @brief One counter per thread, each incremented by its own thread only.
+ */
+template <typename Counter> std::array<Counter, max_threads> counters{};
+
+std::atomic<long>& counter_of(std::atomic<long>& counter)
+{
+    return counter;
+}
+
+template <typename Wrapper> std::atomic<long>& counter_of(Wrapper& counter)
+{
+    return *counter;
+}
+
+template <typename Counter> void BM_per_thread_counters(benchmark::State& state)
+{
+    auto& counter = counter_of(counters<Counter>[static_cast<size_t>(state.thread_index())]);
+    for (auto _ : state)
+    {
+        for (size_t increment = 0; increment < increments_per_iteration; ++increment)
+        {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * increments_per_iteration));
+}
+
+using plain_counter   = std::atomic<long>;
+using aligned_counter = util::cache_aligned<std::atomic<long>>;
+using padded_counter  = util::padded<std::atomic<long>>;
+
+static_assert(util::shares_cache_line_v<plain_counter, max_threads>);
+static_assert(!util::shares_cache_line_v<aligned_counter, max_threads>);
+
+BENCHMARK(BM_per_thread_counters<plain_counter>)
+    ->Name("cache_line/counters/shared_lines")
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
+BENCHMARK(BM_per_thread_counters<aligned_counter>)
+    ->Name("cache_line/counters/cache_aligned")
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
+BENCHMARK(BM_per_thread_counters<padded_counter>)
+    ->Name("cache_line/counters/padded")
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
+} // namespace
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+#
+# Repository:  https://github.com/kingkybel/TypeTraits
+# File Name:   bench/runtime/compare_benchmarks.py
+# Description: Compare two JSON reports of run_benchmarks, e.g. of two commits or two compilers.
+#
+# Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+#
+# @date: 2026-10-17
+# @author: Dieter J Kybelksties
+"""
+Match the benchmarks of two Google Benchmark JSON reports by name and print the change of their real time. Of
+repeated runs the median aggregate is compared, otherwise the fastest run. The exit status is non-zero if any benchmark
+got slower by more than the threshold.
+"""
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(report: Path) -> tuple[dict, dict[str, float]]:
+    """Return the context of a report and the real time in ns of each benchmark."""
+    data = json.loads(report.read_text())
+    medians, fastest = {}, {}
+    for bench in data["benchmarks"]:
+        if bench.get("error_occurred"):
+            continue
+        name = bench.get("run_name", bench["name"])
+        real_time = bench["real_time"] * TIME_UNIT_NS[bench.get("time_unit", "ns")]
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[name] = real_time
+        else:
+            fastest[name] = min(real_time, fastest.get(name, real_time))
+    return data.get("context", {}), fastest | medians
+
+
+def describe(context: dict) -> str:
+    return f"{context.get('compiler', 'unknown compiler')}, {context.get('library_build_type', '')} benchmark library"
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", type=Path, help="report to compare against")
+    parser.add_argument("contender", type=Path, help="report to compare")
+    parser.add_argument("--filter", default=".*", help="regular expression selecting benchmarks by name")
+    parser.add_argument("--threshold", type=float, default=10.0, help="regression threshold in percent")
+    args = parser.parse_args()
+
+    baseline_context, baseline = load(args.baseline)
+    contender_context, contender = load(args.contender)
+    print(f"baseline:  {args.baseline} ({describe(baseline_context)})")
+    print(f"contender: {args.contender} ({describe(contender_context)})")
+
+    regressions = 0
+    print(f"\n{'benchmark':<64}{'baseline':>14}{'contender':>14}{'change':>10}")
+    for name, old in baseline.items():
+        new = contender.get(name)
+        if new is None or not re.search(args.filter, name):
+            continue
+        change_pct = 100.0 * (new - old) / old
+        flag = ""
+        if change_pct > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<64}{old:>12.1f}ns{new:>12.1f}ns{change_pct:>+9.1f}%{flag}")
+
+    only = sorted(set(baseline) ^ set(contender))
+    if only:
+        print(f"\n{len(only)} benchmarks are in one report only")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,120 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/contiguous_bench.cc
+ * Description: per-element copy and comparison against copy_into and equal_ranges.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "contiguous.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief What generic serialisation code does without knowing that a range is contiguous.
+ */
+template <typename Source, typename Out> [[gnu::noinline]] Out per_element_copy(Source const& source, Out out)
+{
+    for (auto const& element : source)
+    {
+        *out = element;
+        ++out;
+    }
+    return out;
+}
+
+template <typename Lhs, typename Rhs> [[gnu::noinline]] bool per_element_equal(Lhs const& lhs, Rhs const& rhs)
+{
+    auto rhs_it = rhs.begin();
+    for (auto const& element : lhs)
+    {
+        if (rhs_it == rhs.end() || !(element == *rhs_it))
+        {
+            return false;
+        }
+        ++rhs_it;
+    }
+    return rhs_it == rhs.end();
+}
+
+std::vector<uint16_t> make_values(size_t size)
+{
+    std::vector<uint16_t> values(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        values[index] = static_cast<uint16_t>(index * 2'654'435'761U);
+    }
+    return values;
+}
+
+void BM_per_element_copy(benchmark::State& state)
+{
+    auto const            source = make_values(static_cast<size_t>(state.range(0)));
+    std::vector<uint16_t> buffer(source.size());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(per_element_copy(source, buffer.begin()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * source.size() * sizeof(uint16_t)));
+}
+
+void BM_copy_into(benchmark::State& state)
+{
+    auto const            source = make_values(static_cast<size_t>(state.range(0)));
+    std::vector<uint16_t> buffer(source.size());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(util::copy_into(source, buffer.begin()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * source.size() * sizeof(uint16_t)));
+}
+
+void BM_per_element_equal(benchmark::State& state)
+{
+    auto const lhs = make_values(static_cast<size_t>(state.range(0)));
+    auto const rhs = lhs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(per_element_equal(lhs, rhs));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * lhs.size() * sizeof(uint16_t)));
+}
+
+void BM_equal_ranges(benchmark::State& state)
+{
+    auto const lhs = make_values(static_cast<size_t>(state.range(0)));
+    auto const rhs = lhs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(util::equal_ranges(lhs, rhs));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * lhs.size() * sizeof(uint16_t)));
+}
+
+BENCHMARK(BM_per_element_copy)->Name("contiguous/copy/per_element")->Range(16, 16384);
+BENCHMARK(BM_copy_into)->Name("contiguous/copy/copy_into")->Range(16, 16384);
+BENCHMARK(BM_per_element_equal)->Name("contiguous/equal/per_element")->Range(16, 16384);
+BENCHMARK(BM_equal_ranges)->Name("contiguous/equal/equal_ranges")->Range(16, 16384);
+} // namespace
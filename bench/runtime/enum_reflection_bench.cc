@@ -0,0 +1,163 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/enum_reflection_bench.cc
+ * Description: time per enum-to-string and string-to-enum conversion, reflected and hand-written.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "enum_reflection.h"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+enum class setting
+{
+    log_level,
+    log_file,
+    listen_address,
+    listen_port,
+    worker_threads,
+    max_connections,
+    idle_timeout,
+    request_timeout,
+    tls_certificate,
+    tls_key,
+    compression,
+    cache_size
+};
+
+/**
+ * @brief What the decoders do today: a hand-written switch ...
+ */
+[[gnu::noinline]] std::string_view switch_name(setting value)
+{
+    switch (value)
+    {
+        case setting::log_level:
+            return "log_level";
+        case setting::log_file:
+            return "log_file";
+        case setting::listen_address:
+            return "listen_address";
+        case setting::listen_port:
+            return "listen_port";
+        case setting::worker_threads:
+            return "worker_threads";
+        case setting::max_connections:
+            return "max_connections";
+        case setting::idle_timeout:
+            return "idle_timeout";
+        case setting::request_timeout:
+            return "request_timeout";
+        case setting::tls_certificate:
+            return "tls_certificate";
+        case setting::tls_key:
+            return "tls_key";
+        case setting::compression:
+            return "compression";
+        case setting::cache_size:
+            return "cache_size";
+    }
+    return {};
+}
+
+/**
+ * @brief ... and a std::map from names, which needs a std::string key built from the string_view of the parser.
+ */
+[[gnu::noinline]] std::optional<setting> map_from_string(std::string_view name)
+{
+    static std::map<std::string, setting> const settings = []
+    {
+        std::map<std::string, setting> map;
+        for (setting const value : util::enum_values_v<setting>)
+        {
+            map.emplace(switch_name(value), value);
+        }
+        return map;
+    }();
+    auto const found = settings.find(std::string(name));
+    return found == settings.end() ? std::nullopt : std::optional<setting>(found->second);
+}
+
+[[gnu::noinline]] std::string_view reflected_name(setting value)
+{
+    return util::enum_name(value);
+}
+
+[[gnu::noinline]] std::optional<setting> reflected_from_string(std::string_view name)
+{
+    return util::enum_from_string<setting>(name);
+}
+
+std::vector<setting> make_values()
+{
+    std::mt19937                          engine{42};
+    std::uniform_int_distribution<size_t> pick{0, util::enum_count_v<setting> - 1};
+    std::vector<setting>                  values;
+    for (size_t count = 0; count < 4'096; ++count)
+    {
+        values.push_back(util::enum_values_v<setting>[pick(engine)]);
+    }
+    return values;
+}
+
+template <std::string_view (*Name)(setting)> void BM_to_string(benchmark::State& state)
+{
+    auto const values = make_values();
+    for (auto _ : state)
+    {
+        for (setting const value : values)
+        {
+            benchmark::DoNotOptimize(Name(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * values.size()));
+}
+
+template <std::optional<setting> (*FromString)(std::string_view)> void BM_from_string(benchmark::State& state)
+{
+    std::vector<std::string> names;
+    for (setting const value : make_values())
+    {
+        names.emplace_back(util::enum_name(value));
+    }
+    for (auto _ : state)
+    {
+        for (auto const& name : names)
+        {
+            benchmark::DoNotOptimize(FromString(name));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * names.size()));
+}
+
+BENCHMARK(BM_to_string<switch_name>)->Name("enum_to_string/switch");
+BENCHMARK(BM_to_string<reflected_name>)->Name("enum_to_string/enum_name");
+BENCHMARK(BM_from_string<map_from_string>)->Name("string_to_enum/std_map");
+BENCHMARK(BM_from_string<reflected_from_string>)->Name("string_to_enum/enum_from_string");
+} // namespace
@@ -0,0 +1,70 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/packed_tuple_bench.cc
+ * Description: benchmarks scanning tables of std::tuple against tables of packed_tuple.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "packed_tuple.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief A table of rows mixing flags, ids and codes: 24 bytes per std::tuple row, 16 per packed_tuple row.
+ */
+template <typename Row> std::vector<Row> make_table(size_t size)
+{
+    std::vector<Row> table;
+    table.reserve(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        table.emplace_back(index % 3 != 0, static_cast<int64_t>(index * 2'654'435'761U), static_cast<char>(index));
+    }
+    return table;
+}
+
+template <typename Row> void BM_scan(benchmark::State& state)
+{
+    auto const table = make_table<Row>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        int64_t total = 0;
+        for (auto const& row : table)
+        {
+            auto const& [valid, id, code] = row;
+            total += valid ? id + code : 0;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * table.size() * sizeof(Row)));
+    state.counters["row_bytes"] = sizeof(Row);
+}
+
+using tuple_row  = std::tuple<bool, int64_t, char>;
+using packed_row = util::packed_tuple<bool, int64_t, char>;
+
+BENCHMARK(BM_scan<tuple_row>)->Name("packed_tuple/scan/std_tuple")->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_scan<packed_row>)->Name("packed_tuple/scan/packed_tuple")->Range(1 << 10, 1 << 22);
+} // namespace
@@ -0,0 +1,127 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/relocate_bench.cc
+ * Description: element-wise move-and-destroy against relocation of trivially relocatable types.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "relocate.h"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Two buffers of state.range(0) objects; the objects are relocated back and forth between them.
+ */
+template <typename T> struct ping_pong
+{
+    explicit ping_pong(size_t count)
+        : count(count)
+        , front(new std::byte[count * sizeof(T)])
+        , back(new std::byte[count * sizeof(T)])
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            ::new (static_cast<void*>(source() + index)) T(std::make_unique<int>(static_cast<int>(index)));
+        }
+    }
+
+    ~ping_pong()
+    {
+        std::destroy_n(source(), count);
+    }
+
+    T* source()
+    {
+        return reinterpret_cast<T*>(front.get());
+    }
+
+    T* destination()
+    {
+        return reinterpret_cast<T*>(back.get());
+    }
+
+    size_t                       count;
+    std::unique_ptr<std::byte[]> front;
+    std::unique_ptr<std::byte[]> back;
+};
+
+/**
+ * @brief What a container does on growth without knowledge of relocatability.
+ */
+template <typename T> void BM_move_and_destroy(benchmark::State& state)
+{
+    ping_pong<T> buffers(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        T* source      = buffers.source();
+        T* destination = buffers.destination();
+        for (size_t index = 0; index < buffers.count; ++index)
+        {
+            ::new (static_cast<void*>(destination + index)) T(std::move(source[index]));
+            source[index].~T();
+        }
+        buffers.front.swap(buffers.back);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * buffers.count));
+}
+
+template <typename T> void BM_relocate(benchmark::State& state)
+{
+    ping_pong<T> buffers(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        util::uninitialized_relocate_n(buffers.source(), buffers.count, buffers.destination());
+        buffers.front.swap(buffers.back);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * buffers.count));
+}
+
+/**
+ * @brief A record with an owning pointer, opted in to relocation through the member typedef.
+ */
+struct record
+{
+    using trivially_relocatable =
+        util::relocatable_if<record, util::all_trivially_relocatable_v<std::unique_ptr<int>, size_t>>;
+
+    explicit record(std::unique_ptr<int> value)
+        : value(std::move(value))
+    {
+    }
+
+    std::unique_ptr<int> value;
+    size_t               size = 0;
+};
+
+static_assert(util::is_trivially_relocatable_v<record>);
+
+BENCHMARK(BM_move_and_destroy<std::unique_ptr<int>>)->Name("relocate/move_and_destroy/unique_ptr")->Range(16, 4096);
+BENCHMARK(BM_relocate<std::unique_ptr<int>>)->Name("relocate/relocate/unique_ptr")->Range(16, 4096);
+BENCHMARK(BM_move_and_destroy<record>)->Name("relocate/move_and_destroy/record")->Range(16, 4096);
+BENCHMARK(BM_relocate<record>)->Name("relocate/relocate/record")->Range(16, 4096);
+} // namespace
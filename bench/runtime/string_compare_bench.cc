@@ -0,0 +1,71 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/string_compare_bench.cc
+ * Description: three-way comparison of long strings with a common prefix: std::char_traits against string_compare.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_compare.h"
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+namespace
+{
+/**
+ * @brief Two strings of state.range(0) code units differing in the last one.
+ */
+template <typename CharT> std::pair<std::basic_string<CharT>, std::basic_string<CharT>> make_pair(size_t size)
+{
+    std::basic_string<CharT> lhs(size, CharT{'a'});
+    std::basic_string<CharT> rhs = lhs;
+    rhs.back()                   = CharT{'b'};
+    return {lhs, rhs};
+}
+
+template <typename CharT> void BM_std_compare(benchmark::State& state)
+{
+    auto const [lhs, rhs] = make_pair<CharT>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lhs.compare(rhs));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * lhs.size() * sizeof(CharT)));
+}
+
+template <typename CharT> void BM_string_compare(benchmark::State& state)
+{
+    auto const [lhs, rhs] = make_pair<CharT>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(util::string_compare{}(lhs, rhs));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * lhs.size() * sizeof(CharT)));
+}
+
+BENCHMARK(BM_std_compare<char>)->Name("string_compare/std/char")->Range(16, 4096);
+BENCHMARK(BM_string_compare<char>)->Name("string_compare/util/char")->Range(16, 4096);
+BENCHMARK(BM_std_compare<char16_t>)->Name("string_compare/std/char16_t")->Range(16, 4096);
+BENCHMARK(BM_string_compare<char16_t>)->Name("string_compare/util/char16_t")->Range(16, 4096);
+BENCHMARK(BM_std_compare<char32_t>)->Name("string_compare/std/char32_t")->Range(16, 4096);
+BENCHMARK(BM_string_compare<char32_t>)->Name("string_compare/util/char32_t")->Range(16, 4096);
+BENCHMARK(BM_std_compare<wchar_t>)->Name("string_compare/std/wchar_t")->Range(16, 4096);
+BENCHMARK(BM_string_compare<wchar_t>)->Name("string_compare/util/wchar_t")->Range(16, 4096);
+} // namespace
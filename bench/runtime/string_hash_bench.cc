@@ -0,0 +1,134 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/string_hash_bench.cc
+ * Description: allocations and time per unordered_map lookup with and without transparent string functors.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_hash.h"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+// counts every allocation of the benchmark binary
+std::atomic<size_t> allocation_count{0};
+} // namespace
+
+// the replacements are not inlined, or GCC pairs malloc()/free() with operator new/delete and warns about a mismatch
+[[gnu::noinline]] void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+[[gnu::noinline]] void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, size_t /* size */) noexcept
+{
+    std::free(memory);
+}
+
+namespace
+{
+constexpr size_t key_count = 10'000;
+
+/**
+ * @brief Keys like the ones of request routing: longer than the small string buffer.
+ */
+std::vector<std::string> make_keys()
+{
+    std::vector<std::string> keys;
+    keys.reserve(key_count);
+    for (size_t index = 0; index < key_count; ++index)
+    {
+        keys.push_back("/api/v2/tenants/acme/resources/" + std::to_string(index));
+    }
+    return keys;
+}
+
+template <typename Map> Map make_map(std::vector<std::string> const& keys)
+{
+    Map map;
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        map.emplace(keys[index], static_cast<int>(index));
+    }
+    return map;
+}
+
+/**
+ * @brief Look up every key as Lookup, reporting time and heap allocations per lookup.
+ */
+template <typename Map, typename Lookup> void BM_lookup(benchmark::State& state)
+{
+    auto const               keys = make_keys();
+    auto const               map  = make_map<Map>(keys);
+    std::vector<char const*> pointers;
+    for (auto const& key : keys)
+    {
+        pointers.push_back(key.c_str());
+    }
+
+    size_t const allocations_before = allocation_count.load(std::memory_order_relaxed);
+    size_t       lookups            = 0;
+    for (auto _ : state)
+    {
+        for (char const* pointer : pointers)
+        {
+            if constexpr (std::is_same_v<Lookup, std::string>)
+            {
+                // what a non-transparent map forces on callers holding a char const* or a string_view
+                benchmark::DoNotOptimize(map.find(std::string(pointer)));
+            }
+            else
+            {
+                benchmark::DoNotOptimize(map.find(Lookup(pointer)));
+            }
+        }
+        lookups += pointers.size();
+    }
+    size_t const allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+    state.counters["allocs_per_lookup"] =
+        benchmark::Counter(static_cast<double>(allocations) / static_cast<double>(lookups));
+    state.SetItemsProcessed(static_cast<int64_t>(lookups));
+}
+
+using std_map         = std::unordered_map<std::string, int>;
+using transparent_map = std::unordered_map<std::string, int, util::string_hash, util::string_equal>;
+
+BENCHMARK(BM_lookup<std_map, std::string>)->Name("string_lookup/std_hash/temporary_string");
+BENCHMARK(BM_lookup<transparent_map, char const*>)->Name("string_lookup/string_hash/char_pointer");
+BENCHMARK(BM_lookup<transparent_map, std::string_view>)->Name("string_lookup/string_hash/string_view");
+} // namespace
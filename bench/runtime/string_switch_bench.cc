@@ -0,0 +1,172 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/string_switch_bench.cc
+ * Description: time per dispatch of a run-time string by string_switch and by a chain of comparisons.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_switch.h"
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using verbs = util::string_switch<"GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH">;
+
+using headers = util::string_switch<"Accept",
+                                    "Accept-Charset",
+                                    "Accept-Encoding",
+                                    "Accept-Language",
+                                    "Authorization",
+                                    "Cache-Control",
+                                    "Connection",
+                                    "Content-Encoding",
+                                    "Content-Length",
+                                    "Content-Type",
+                                    "Cookie",
+                                    "Date",
+                                    "ETag",
+                                    "Expect",
+                                    "Forwarded",
+                                    "From",
+                                    "Host",
+                                    "If-Match",
+                                    "If-Modified-Since",
+                                    "If-None-Match",
+                                    "If-Range",
+                                    "If-Unmodified-Since",
+                                    "Keep-Alive",
+                                    "Origin",
+                                    "Pragma",
+                                    "Range",
+                                    "Referer",
+                                    "TE",
+                                    "Trailer",
+                                    "Transfer-Encoding",
+                                    "Upgrade",
+                                    "User-Agent",
+                                    "Via",
+                                    "X-Forwarded-For",
+                                    "X-Request-Id",
+                                    "X-Unknown-Header">;
+
+// the same keys in the same order, for the comparison chains
+constexpr std::array<std::string_view, verbs::size> verb_names{
+    "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH"};
+
+constexpr std::array<std::string_view, headers::size> header_names{
+    "Accept",
+    "Accept-Charset",
+    "Accept-Encoding",
+    "Accept-Language",
+    "Authorization",
+    "Cache-Control",
+    "Connection",
+    "Content-Encoding",
+    "Content-Length",
+    "Content-Type",
+    "Cookie",
+    "Date",
+    "ETag",
+    "Expect",
+    "Forwarded",
+    "From",
+    "Host",
+    "If-Match",
+    "If-Modified-Since",
+    "If-None-Match",
+    "If-Range",
+    "If-Unmodified-Since",
+    "Keep-Alive",
+    "Origin",
+    "Pragma",
+    "Range",
+    "Referer",
+    "TE",
+    "Trailer",
+    "Transfer-Encoding",
+    "Upgrade",
+    "User-Agent",
+    "Via",
+    "X-Forwarded-For",
+    "X-Request-Id",
+    "X-Unknown-Header"};
+
+/**
+ * @brief What the protocol parsers do today: compare with every key in turn, i.e. an if/else chain of ==.
+ */
+template <auto const& Names> [[gnu::noinline]] size_t comparison_chain(std::string_view str)
+{
+    size_t index = 0;
+    while (index < Names.size() && Names[index] != str)
+    {
+        ++index;
+    }
+    return index;
+}
+
+template <typename Switch> [[gnu::noinline]] size_t perfect_hash_switch(std::string_view str)
+{
+    return Switch::index_of(str);
+}
+
+/**
+ * @brief Inputs drawn uniformly from the keys, with one in nine not a key, each in its own std::string.
+ */
+template <size_t N> std::vector<std::string> make_inputs(std::array<std::string_view, N> const& names)
+{
+    std::mt19937                          engine{42};
+    std::uniform_int_distribution<size_t> pick{0, N + N / 8};
+    std::vector<std::string>              inputs;
+    for (size_t count = 0; count < 4'096; ++count)
+    {
+        size_t const index = pick(engine);
+        inputs.emplace_back(index < N ? names[index] : std::string_view("X-Not-A-Key"));
+    }
+    return inputs;
+}
+
+/**
+ * @brief Map every input to its index with Dispatch.
+ */
+template <auto const& Names, size_t (*Dispatch)(std::string_view)> void BM_dispatch(benchmark::State& state)
+{
+    auto const inputs = make_inputs(Names);
+    for (auto _ : state)
+    {
+        for (auto const& input : inputs)
+        {
+            benchmark::DoNotOptimize(Dispatch(input));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * inputs.size()));
+}
+
+BENCHMARK(BM_dispatch<verb_names, comparison_chain<verb_names>>)->Name("string_dispatch/verbs/comparison_chain");
+BENCHMARK(BM_dispatch<verb_names, perfect_hash_switch<verbs>>)->Name("string_dispatch/verbs/string_switch");
+BENCHMARK(BM_dispatch<header_names, comparison_chain<header_names>>)->Name("string_dispatch/headers/comparison_chain");
+BENCHMARK(BM_dispatch<header_names, perfect_hash_switch<headers>>)->Name("string_dispatch/headers/string_switch");
+} // namespace
@@ -0,0 +1,270 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/traits_bench.cc
+ * Description: string_or_char_size, charToChar and the std::hash paths probed by has_std_hash, over every string kind
+ *              and character type, from 1 B to 16 MiB, with warm and cold caches.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#include "traits.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace
+{
+constexpr int64_t min_bytes = 1;
+constexpr int64_t max_bytes = 16 << 20;
+
+enum class cache_state
+{
+    warm, ///< the same input every iteration, so it stays in the caches as far as it fits
+    cold  ///< the input is flushed from all cache levels before every iteration
+};
+
+constexpr size_t cache_line = 64;
+
+// names of the runs, e.g. "string_or_char_size/char_pointer/char16_t/cold/4096"
+template <typename CharT> constexpr char const* char_name = "char";
+template <> constexpr char const* char_name<wchar_t>  = "wchar_t";
+template <> constexpr char const* char_name<char16_t> = "char16_t";
+template <> constexpr char const* char_name<char32_t> = "char32_t";
+
+constexpr char const* kind_name(util::string_kind kind)
+{
+    switch (kind)
+    {
+        case util::string_kind::std_string:
+            return "std_string";
+        case util::string_kind::std_string_view:
+            return "std_string_view";
+        case util::string_kind::char_pointer:
+            return "char_pointer";
+        case util::string_kind::char_array:
+            return "char_array";
+        default:
+            return "other";
+    }
+}
+
+constexpr char const* state_name(cache_state state)
+{
+    return state == cache_state::warm ? "warm" : "cold";
+}
+
+/**
+ * @brief Write back and evict the cache lines of [data, data + bytes) from every level of the cache hierarchy.
+ */
+void flush(void const* data, size_t bytes)
+{
+    auto const* first = static_cast<char const*>(data);
+    auto const* last  = first + bytes;
+    for (auto const* line = first - reinterpret_cast<uintptr_t>(first) % cache_line; line < last; line += cache_line)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_clflush(line);
+#elif defined(__aarch64__)
+        asm volatile("dc civac, %0" : : "r"(line) : "memory");
+#endif
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_mfence();
+#elif defined(__aarch64__)
+    asm volatile("dsb ish" : : : "memory");
+#endif
+}
+
+/**
+ * @brief String of state.range(0) bytes (at least one code unit) with a terminator, not containing the terminator.
+ */
+template <typename CharT> std::basic_string<CharT> make_input(benchmark::State const& state)
+{
+    size_t const units = std::max<size_t>(1, static_cast<size_t>(state.range(0)) / sizeof(CharT));
+    std::basic_string<CharT> str(units, CharT{});
+    for (size_t index = 0; index < units; ++index)
+    {
+        str[index] = static_cast<CharT>('a' + index % 26);
+    }
+    return str;
+}
+
+/**
+ * @brief The input as the given string kind; char arrays as arrays of unknown bound, since the size is not a constant.
+ */
+template <util::string_kind Kind, typename CharT> decltype(auto) as_kind(std::basic_string<CharT> const& str)
+{
+    if constexpr (Kind == util::string_kind::std_string)
+    {
+        return (str);
+    }
+    else if constexpr (Kind == util::string_kind::std_string_view)
+    {
+        return std::basic_string_view<CharT>{str};
+    }
+    else if constexpr (Kind == util::string_kind::char_pointer)
+    {
+        return str.c_str();
+    }
+    else
+    {
+        return *reinterpret_cast<CharT const(*)[]>(str.c_str());
+    }
+}
+
+/**
+ * @brief Evict the input, its string object and the output before a cold iteration, outside of the timed region.
+ */
+template <cache_state State, typename CharT, typename OutputT = char>
+void prepare(benchmark::State&                 state,
+             std::basic_string<CharT> const&   str,
+             std::basic_string<OutputT> const* output = nullptr)
+{
+    if constexpr (State == cache_state::cold)
+    {
+        state.PauseTiming();
+        flush(&str, sizeof(str));
+        flush(str.data(), (str.size() + 1) * sizeof(CharT));
+        if (output != nullptr)
+        {
+            flush(output->data(), output->size() * sizeof(OutputT));
+        }
+        state.ResumeTiming();
+    }
+}
+
+template <typename CharT> void set_bytes(benchmark::State& state, std::basic_string<CharT> const& str)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * str.size() * sizeof(CharT)));
+}
+
+template <typename CharT, util::string_kind Kind, cache_state State>
+void BM_string_or_char_size(benchmark::State& state)
+{
+    auto const str = make_input<CharT>(state);
+    for (auto _ : state)
+    {
+        prepare<State>(state, str);
+        benchmark::DoNotOptimize(util::string_or_char_size(as_kind<Kind>(str)));
+    }
+    set_bytes(state, str);
+}
+
+template <typename CharT, util::string_kind Kind, cache_state State> void BM_std_hash(benchmark::State& state)
+{
+    auto const str = make_input<CharT>(state);
+    for (auto _ : state)
+    {
+        prepare<State>(state, str);
+        if constexpr (Kind == util::string_kind::std_string)
+        {
+            benchmark::DoNotOptimize(std::hash<std::basic_string<CharT>>{}(str));
+        }
+        else
+        {
+            // pointers and arrays are hashed by content, as the string view up to their terminator
+            auto const view = util::as_string_view(as_kind<Kind>(str));
+            benchmark::DoNotOptimize(std::hash<std::basic_string_view<CharT>>{}(view));
+        }
+    }
+    set_bytes(state, str);
+}
+
+template <typename From, typename To, cache_state State> void BM_char_to_char(benchmark::State& state)
+{
+    auto const            str = make_input<From>(state);
+    std::basic_string<To> output(str.size(), To{});
+    for (auto _ : state)
+    {
+        prepare<State>(state, str, &output);
+        std::transform(str.begin(), str.end(), output.begin(), [](From c) { return util::charToChar<To>(c); });
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    set_bytes(state, str);
+}
+
+template <typename Function> void register_sizes(std::string const& name, Function function)
+{
+    benchmark::RegisterBenchmark(name.c_str(), function)->RangeMultiplier(8)->Range(min_bytes, max_bytes);
+}
+
+template <typename CharT, util::string_kind Kind> void register_kind()
+{
+    std::string const suffix = std::string{"/"} + kind_name(Kind) + "/" + char_name<CharT> + "/";
+    register_sizes("string_or_char_size" + suffix + state_name(cache_state::warm),
+                   BM_string_or_char_size<CharT, Kind, cache_state::warm>);
+    register_sizes("string_or_char_size" + suffix + state_name(cache_state::cold),
+                   BM_string_or_char_size<CharT, Kind, cache_state::cold>);
+    register_sizes("std_hash" + suffix + state_name(cache_state::warm), BM_std_hash<CharT, Kind, cache_state::warm>);
+    register_sizes("std_hash" + suffix + state_name(cache_state::cold), BM_std_hash<CharT, Kind, cache_state::cold>);
+}
+
+template <typename CharT> void register_char_type()
+{
+    register_kind<CharT, util::string_kind::std_string>();
+    register_kind<CharT, util::string_kind::std_string_view>();
+    register_kind<CharT, util::string_kind::char_pointer>();
+    register_kind<CharT, util::string_kind::char_array>();
+}
+
+template <typename From, typename To> void register_conversion()
+{
+    std::string const name = std::string{"char_to_char/"} + char_name<From> + "/" + char_name<To> + "/";
+    register_sizes(name + state_name(cache_state::warm), BM_char_to_char<From, To, cache_state::warm>);
+    register_sizes(name + state_name(cache_state::cold), BM_char_to_char<From, To, cache_state::cold>);
+}
+
+// the compiler goes into the context of the JSON report, so that reports of different compilers can be told apart
+std::string compiler_version()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+bool const registered = []
+{
+    benchmark::AddCustomContext("compiler", compiler_version());
+
+    register_char_type<char>();
+    register_char_type<wchar_t>();
+    register_char_type<char16_t>();
+    register_char_type<char32_t>();
+
+    register_conversion<char, wchar_t>();
+    register_conversion<char, char16_t>();
+    register_conversion<char, char32_t>();
+    register_conversion<char16_t, char>();
+    register_conversion<char32_t, char>();
+    return true;
+}();
+} // namespace
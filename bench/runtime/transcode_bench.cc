@@ -0,0 +1,127 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/transcode_bench.cc
+ * Description: throughput of util::transcode against a per-code-point loop.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "transcode.h"
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+
+namespace
+{
+constexpr size_t text_size = 1UL << 20; // code units of input per iteration
+
+/**
+ * @brief Input text: the sample repeated to text_size code units.
+ */
+template <typename CharT> std::basic_string<CharT> make_text(std::basic_string_view<CharT> sample)
+{
+    std::basic_string<CharT> text;
+    while (text.size() < text_size)
+    {
+        text.append(sample);
+    }
+    return text;
+}
+
+// clang-format off
+constexpr std::u16string_view ascii_sample = u"The quick brown fox jumps over the lazy dog. ";
+constexpr std::u16string_view latin_sample = u"Grüße aus Köln, schöne Straße. ";
+constexpr std::u16string_view cjk_sample   = u"中文文本的转码吞吐量测试。";
+constexpr std::u16string_view emoji_sample = u"\U0001F600\U0001F680 ok ";
+// clang-format on
+
+/**
+ * @brief What a hand-rolled loop does: decode and encode one code point at a time, appending to the output.
+ */
+template <typename ToChar, typename FromChar>
+void per_code_point(std::basic_string_view<FromChar> from, std::basic_string<ToChar>& out)
+{
+    for (size_t index = 0; index < from.size();)
+    {
+        auto const decoded = util::detail::decode_one(from.data() + index, from.size() - index);
+        ToChar     units[4];
+        out.append(units, util::detail::encode_one(decoded.code_point, units));
+        index += decoded.length;
+    }
+}
+
+template <typename ToChar, typename FromChar>
+void BM_transcode(benchmark::State& state, std::basic_string<FromChar> const& text)
+{
+    std::basic_string<ToChar> out;
+    for (auto _ : state)
+    {
+        out.clear();
+        benchmark::DoNotOptimize(util::transcode(text, out));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size() * sizeof(FromChar)));
+}
+
+template <typename ToChar, typename FromChar>
+void BM_per_code_point(benchmark::State& state, std::basic_string<FromChar> const& text)
+{
+    std::basic_string<ToChar> out;
+    for (auto _ : state)
+    {
+        out.clear();
+        per_code_point<ToChar, FromChar>(text, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size() * sizeof(FromChar)));
+}
+
+template <typename ToChar, typename FromChar>
+void register_pair(std::string const& name, std::basic_string<FromChar> const& text)
+{
+    benchmark::RegisterBenchmark(("transcode/" + name).c_str(), [text](benchmark::State& state) {
+        BM_transcode<ToChar>(state, text);
+    });
+    benchmark::RegisterBenchmark(("per_code_point/" + name).c_str(), [text](benchmark::State& state) {
+        BM_per_code_point<ToChar>(state, text);
+    });
+}
+
+int const registered = [] {
+    for (auto const& [label, sample] : {std::pair{"ascii", ascii_sample},
+                                        std::pair{"latin", latin_sample},
+                                        std::pair{"cjk", cjk_sample},
+                                        std::pair{"emoji", emoji_sample}})
+    {
+        std::u16string const utf16 = make_text(sample);
+        std::string          utf8;
+        util::transcode(utf16, utf8);
+        std::u32string utf32;
+        util::transcode(utf16, utf32);
+
+        register_pair<char>(std::string("utf16_to_utf8/") + label, utf16);
+        register_pair<char32_t>(std::string("utf16_to_utf32/") + label, utf16);
+        register_pair<char16_t>(std::string("utf8_to_utf16/") + label, utf8);
+        register_pair<char16_t>(std::string("utf32_to_utf16/") + label, utf32);
+    }
+    return 0;
+}();
+} // namespace
@@ -0,0 +1,146 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/tuple_algorithms_bench.cc
+ * Description: tuple_for_each, tuple_transform and tuple_fold against the same code written out by hand.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "tuple_algorithms.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using record = std::tuple<int32_t, int64_t, float, double, uint16_t, uint32_t, int8_t, double>;
+
+std::vector<record> make_records()
+{
+    std::vector<record> records;
+    for (int index = 0; index < 1024; ++index)
+    {
+        records.emplace_back(index, index * 3L, index * 0.5F, index * 0.25, index, index * 7U, index % 100, index);
+    }
+    return records;
+}
+
+// Each pair of functions below must compile to the same instructions: the tuple algorithms add no calls, loops or
+// index recursion over what is written out by hand.
+
+auto const plus = [](double acc, auto element) { return acc + element; };
+
+[[gnu::noinline]] double fold_by_hand(record const& rec)
+{
+    double acc = plus(0.0, std::get<0>(rec));
+    acc        = plus(acc, std::get<1>(rec));
+    acc        = plus(acc, std::get<2>(rec));
+    acc        = plus(acc, std::get<3>(rec));
+    acc        = plus(acc, std::get<4>(rec));
+    acc        = plus(acc, std::get<5>(rec));
+    acc        = plus(acc, std::get<6>(rec));
+    return plus(acc, std::get<7>(rec));
+}
+
+[[gnu::noinline]] double fold_by_algorithm(record const& rec)
+{
+    return util::tuple_fold(rec, 0.0, plus);
+}
+
+[[gnu::noinline]] void scale_by_hand(record& rec)
+{
+    std::get<0>(rec) *= 3;
+    std::get<1>(rec) *= 3;
+    std::get<2>(rec) *= 3;
+    std::get<3>(rec) *= 3;
+    std::get<4>(rec) *= 3;
+    std::get<5>(rec) *= 3;
+    std::get<6>(rec) *= 3;
+    std::get<7>(rec) *= 3;
+}
+
+[[gnu::noinline]] void scale_by_algorithm(record& rec)
+{
+    util::tuple_for_each(rec, [](auto& element) { element *= 3; });
+}
+
+[[gnu::noinline]] auto widen_by_hand(record const& rec)
+{
+    return std::tuple{static_cast<double>(std::get<0>(rec)), static_cast<double>(std::get<1>(rec)),
+                      static_cast<double>(std::get<2>(rec)), static_cast<double>(std::get<3>(rec)),
+                      static_cast<double>(std::get<4>(rec)), static_cast<double>(std::get<5>(rec)),
+                      static_cast<double>(std::get<6>(rec)), static_cast<double>(std::get<7>(rec))};
+}
+
+[[gnu::noinline]] auto widen_by_algorithm(record const& rec)
+{
+    return util::tuple_transform(rec, [](auto element) { return static_cast<double>(element); });
+}
+
+template <auto Fold> void BM_fold(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        double total = 0.0;
+        for (auto const& rec : records)
+        {
+            total += Fold(rec);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * records.size()));
+}
+
+template <auto Scale> void BM_for_each(benchmark::State& state)
+{
+    auto records = make_records();
+    for (auto _ : state)
+    {
+        for (auto& rec : records)
+        {
+            Scale(rec);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * records.size()));
+}
+
+template <auto Widen> void BM_transform(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        for (auto const& rec : records)
+        {
+            benchmark::DoNotOptimize(Widen(rec));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * records.size()));
+}
+
+BENCHMARK(BM_fold<fold_by_hand>)->Name("tuple/fold/by_hand");
+BENCHMARK(BM_fold<fold_by_algorithm>)->Name("tuple/fold/tuple_fold");
+BENCHMARK(BM_for_each<scale_by_hand>)->Name("tuple/for_each/by_hand");
+BENCHMARK(BM_for_each<scale_by_algorithm>)->Name("tuple/for_each/tuple_for_each");
+BENCHMARK(BM_transform<widen_by_hand>)->Name("tuple/transform/by_hand");
+BENCHMARK(BM_transform<widen_by_algorithm>)->Name("tuple/transform/tuple_transform");
+} // namespace
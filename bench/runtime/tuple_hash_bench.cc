@@ -0,0 +1,120 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/tuple_hash_bench.cc
+ * Description: util::hash of std::tuple<std::string, int, int> keys against a hand-written hash_combine hasher.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "tuple_algorithms.h"
+
+#include "tuple_hash.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using key = std::tuple<std::string, int, int>;
+
+// the hand-written hasher util::hash replaces
+struct hash_combine_key
+{
+    static void combine(size_t& seed, size_t hash) noexcept
+    {
+        seed ^= hash + 0x9e37'79b9 + (seed << 6) + (seed >> 2);
+    }
+
+    size_t operator()(key const& value) const noexcept
+    {
+        size_t seed = 0;
+        combine(seed, std::hash<std::string>{}(std::get<0>(value)));
+        combine(seed, std::hash<int>{}(std::get<1>(value)));
+        combine(seed, std::hash<int>{}(std::get<2>(value)));
+        return seed;
+    }
+};
+
+// routing-table like keys: few interface names, small integers
+std::vector<key> make_keys(size_t count)
+{
+    std::vector<key> keys;
+    keys.reserve(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        keys.emplace_back("eth" + std::to_string(index % 16),
+                          static_cast<int>(index / 16 % 256),
+                          static_cast<int>(index / 4096));
+    }
+    return keys;
+}
+
+template <typename Hash> void BM_hash(benchmark::State& state)
+{
+    auto const          keys = make_keys(static_cast<size_t>(state.range(0)));
+    std::vector<size_t> hashes(keys.size());
+    for (auto _ : state)
+    {
+        std::transform(keys.begin(), keys.end(), hashes.begin(), Hash{});
+        benchmark::DoNotOptimize(hashes.data());
+        benchmark::ClobberMemory();
+    }
+    // different keys with the same hash, which no table size can separate
+    std::sort(hashes.begin(), hashes.end());
+    auto const distinct          = std::unique(hashes.begin(), hashes.end()) - hashes.begin();
+    state.counters["collisions"] = static_cast<double>(keys.size() - static_cast<size_t>(distinct));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+
+template <typename Hash> void BM_map_find(benchmark::State& state)
+{
+    auto const                        keys = make_keys(static_cast<size_t>(state.range(0)));
+    std::unordered_map<key, int, Hash> map;
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        map.emplace(keys[index], static_cast<int>(index));
+    }
+    for (auto _ : state)
+    {
+        for (auto const& k : keys)
+        {
+            benchmark::DoNotOptimize(map.find(k));
+        }
+    }
+    size_t longest_chain = 0;
+    for (size_t bucket = 0; bucket < map.bucket_count(); ++bucket)
+    {
+        longest_chain = std::max(longest_chain, map.bucket_size(bucket));
+    }
+    state.counters["longest_chain"] = static_cast<double>(longest_chain);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+
+BENCHMARK(BM_hash<hash_combine_key>)->Name("tuple_hash/hash_combine")->Range(256, 1 << 16);
+BENCHMARK(BM_hash<util::hash<key>>)->Name("tuple_hash/util_hash")->Range(256, 1 << 16);
+BENCHMARK(BM_map_find<hash_combine_key>)->Name("tuple_map_find/hash_combine")->Range(256, 1 << 16);
+BENCHMARK(BM_map_find<util::hash<key>>)->Name("tuple_map_find/util_hash")->Range(256, 1 << 16);
+} // namespace
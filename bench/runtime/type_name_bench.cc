@@ -0,0 +1,101 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/type_name_bench.cc
+ * Description: time per look-up in a registry keyed by std::type_index and by type_id.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "type_name.h"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+template <int> struct event
+{
+};
+
+constexpr int event_count = 64;
+
+/**
+ * @brief Keys of every event type, in a fixed pseudo-random order of dispatch.
+ */
+template <typename Key, typename MakeKey> std::vector<Key> make_keys(MakeKey make_key)
+{
+    std::vector<Key> all = [&]<int... Is>(std::integer_sequence<int, Is...>)
+    {
+        return std::vector<Key>{make_key.template operator()<event<Is>>()...};
+    }(std::make_integer_sequence<int, event_count>{});
+
+    std::vector<Key> keys;
+    for (size_t count = 0, index = 0; count < 4'096; ++count, index = (index * 37 + 11) % all.size())
+    {
+        keys.push_back(all[index]);
+    }
+    return keys;
+}
+
+/**
+ * @brief Look up the handler of every dispatched event in a registry keyed on Key.
+ */
+template <typename Key, typename MakeKey> void BM_registry(benchmark::State& state)
+{
+    auto const                   keys = make_keys<Key>(MakeKey{});
+    std::unordered_map<Key, int> registry;
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        registry.emplace(keys[index], static_cast<int>(index));
+    }
+    for (auto _ : state)
+    {
+        for (Key const& key : keys)
+        {
+            benchmark::DoNotOptimize(registry.find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+
+struct make_type_index
+{
+    template <typename T> std::type_index operator()() const
+    {
+        return std::type_index(typeid(T));
+    }
+};
+
+struct make_type_id
+{
+    template <typename T> uint64_t operator()() const
+    {
+        return util::type_id_v<T>;
+    }
+};
+
+BENCHMARK(BM_registry<std::type_index, make_type_index>)->Name("type_registry/std_type_index");
+BENCHMARK(BM_registry<uint64_t, make_type_id>)->Name("type_registry/type_id");
+} // namespace
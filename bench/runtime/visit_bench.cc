@@ -0,0 +1,168 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   bench/runtime/visit_bench.cc
+ * Description: time per visitation of variants with 4 to 256 alternatives, util::visit_indexed against std::visit.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "visit.h"
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace
+{
+template <size_t I> struct alternative
+{
+    int value;
+};
+
+template <typename Indices> struct variant_over;
+
+template <size_t... Is> struct variant_over<std::index_sequence<Is...>>
+{
+    using type = std::variant<alternative<Is>...>;
+};
+
+template <size_t N> using variant_of = typename variant_over<std::make_index_sequence<N>>::type;
+
+/**
+ * @brief How the alternatives of consecutive variants are drawn.
+ */
+enum class pattern
+{
+    random, // uniformly, so that the dispatch is mispredicted most of the time
+    bursts  // uniformly, but in runs of 64 equal alternatives, as messages of a kind often arrive
+};
+
+template <size_t N> std::vector<variant_of<N>> make_variants(pattern drawn)
+{
+    static constexpr auto make = []<size_t... Is>(std::index_sequence<Is...>)
+    {
+        return std::array<variant_of<N> (*)(int), N>{
+            [](int value) { return variant_of<N>{std::in_place_index<Is>, alternative<Is>{value}}; }...};
+    }(std::make_index_sequence<N>{});
+
+    std::mt19937                          engine{42};
+    std::uniform_int_distribution<size_t> pick{0, N - 1};
+    std::vector<variant_of<N>>            variants;
+    size_t                                index = 0;
+    for (size_t count = 0; count < 4'096; ++count)
+    {
+        if (drawn == pattern::random || count % 64 == 0)
+        {
+            index = pick(engine);
+        }
+        variants.push_back(make[index](static_cast<int>(count)));
+    }
+    return variants;
+}
+
+// a different computation per alternative, as a visitor of messages would have
+constexpr auto visitor = []<size_t I>(alternative<I> const& held) { return held.value * static_cast<int>(I + 1); };
+
+struct std_visit
+{
+    template <typename Variant> static int apply(Variant const& variant)
+    {
+        return std::visit(visitor, variant);
+    }
+};
+
+struct util_visit_indexed
+{
+    template <typename Variant> static int apply(Variant const& variant)
+    {
+        return util::visit_indexed([](auto, auto const& held) { return visitor(held); }, variant);
+    }
+};
+
+template <typename Visit, size_t N, pattern Drawn> void BM_visit(benchmark::State& state)
+{
+    auto const variants = make_variants<N>(Drawn);
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (auto const& variant : variants)
+        {
+            sum += Visit::apply(variant);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * variants.size()));
+}
+
+/**
+ * @brief Two variants visited together: combinations of N alternatives each.
+ */
+template <typename Visit, size_t N> void BM_visit_pair(benchmark::State& state)
+{
+    auto const firsts  = make_variants<N>(pattern::random);
+    auto const seconds = make_variants<N>(pattern::random);
+    auto const pair    = []<size_t I, size_t J>(alternative<I> const& lhs, alternative<J> const& rhs)
+    {
+        return lhs.value * static_cast<int>(I + 1) - rhs.value * static_cast<int>(J + 1);
+    };
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (size_t index = 0; index < firsts.size(); ++index)
+        {
+            if constexpr (std::is_same_v<Visit, std_visit>)
+            {
+                sum += std::visit(pair, firsts[index], seconds[index]);
+            }
+            else
+            {
+                sum += util::visit_indexed([&pair](auto, auto, auto const& lhs, auto const& rhs)
+                                           { return pair(lhs, rhs); },
+                                           firsts[index],
+                                           seconds[index]);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * firsts.size()));
+}
+
+BENCHMARK(BM_visit<std_visit, 4, pattern::random>)->Name("visit/4/random/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 4, pattern::random>)->Name("visit/4/random/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 4, pattern::bursts>)->Name("visit/4/bursts/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 4, pattern::bursts>)->Name("visit/4/bursts/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 16, pattern::random>)->Name("visit/16/random/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 16, pattern::random>)->Name("visit/16/random/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 16, pattern::bursts>)->Name("visit/16/bursts/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 16, pattern::bursts>)->Name("visit/16/bursts/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 64, pattern::random>)->Name("visit/64/random/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 64, pattern::random>)->Name("visit/64/random/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 64, pattern::bursts>)->Name("visit/64/bursts/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 64, pattern::bursts>)->Name("visit/64/bursts/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 256, pattern::random>)->Name("visit/256/random/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 256, pattern::random>)->Name("visit/256/random/util_visit_indexed");
+BENCHMARK(BM_visit<std_visit, 256, pattern::bursts>)->Name("visit/256/bursts/std_visit");
+BENCHMARK(BM_visit<util_visit_indexed, 256, pattern::bursts>)->Name("visit/256/bursts/util_visit_indexed");
+BENCHMARK(BM_visit_pair<std_visit, 16>)->Name("visit_pair/16x16/random/std_visit");
+BENCHMARK(BM_visit_pair<util_visit_indexed, 16>)->Name("visit_pair/16x16/random/util_visit_indexed");
+} // namespace
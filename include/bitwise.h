@@ -0,0 +1,324 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/bitwise.h
+ * Description: Traits for types whose objects can be compared and hashed by their bytes, and bulk equality and hashing
+ *              built on them.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef BITWISE_H_INCLUDED
+#define BITWISE_H_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Member-typedef hook: a class declaring "using bitwise_equality_comparable = std::true_type;" states that its
+ * operator== compares exactly its bytes, as a defaulted operator== of members that do so themselves does.
+ */
+template <typename T, typename = void> struct bitwise_equality_member_hook : std::false_type
+{
+};
+
+template <typename T>
+struct bitwise_equality_member_hook<T, std::void_t<typename T::bitwise_equality_comparable>>
+    : std::bool_constant<T::bitwise_equality_comparable::value>
+{
+};
+} // namespace detail
+
+/**
+ * @brief Trait to identify types whose objects are equal exactly if their bytes are, so that == on them can be replaced
+ * by memcmp. Requires a unique object representation - no padding, and no second representation of a value as
+ * floating point has (-0.0, NaN) - and an operator== that compares the value: true for integers, enumerations and
+ * pointers, and for classes without padding that opt in through the member typedef "bitwise_equality_comparable".
+ * Other types opt in by specialising this template, which makes them responsible for both conditions.
+ *
+ * @code{.cpp}
+ * struct Record
+ * {
+ *     using bitwise_equality_comparable = std::true_type;
+ *
+ *     std::uint32_t id;
+ *     std::uint32_t flags;
+ *     std::uint64_t offset;
+ *
+ *     bool operator==(Record const&) const = default;
+ * };
+ * static_assert(util::is_bitwise_equality_comparable_v<Record>);
+ * @endcode
+ */
+template <typename T>
+struct is_bitwise_equality_comparable
+    : std::bool_constant<std::has_unique_object_representations_v<T> &&
+                         (std::is_scalar_v<T> || detail::bitwise_equality_member_hook<T>::value)>
+{
+};
+
+template <typename T> using is_bitwise_equality_comparable_t = typename is_bitwise_equality_comparable<T>::type;
+
+template <typename T>
+inline constexpr bool is_bitwise_equality_comparable_v = is_bitwise_equality_comparable<T>::value;
+
+/**
+ * @brief Arrays compare like their elements.
+ */
+template <typename T, size_t sz>
+struct is_bitwise_equality_comparable<T[sz]> : is_bitwise_equality_comparable<T>
+{
+};
+
+/**
+ * @brief Equality of two spans of the same element type: equal sizes and equal elements. Bitwise equality comparable
+ * elements are compared with a single memcmp, which the C library vectorises; all others element by element with
+ * operator==.
+ *
+ * @code{.cpp}
+ * std::vector<Record> const& previous = batches[i - 1];
+ * if (util::fast_equal(std::span{previous}, std::span{batches[i]}))
+ * {
+ *     // duplicate batch
+ * }
+ * @endcode
+ */
+template <typename Lhs, size_t LhsExtent, typename Rhs, size_t RhsExtent>
+requires std::is_same_v<std::remove_cv_t<Lhs>, std::remove_cv_t<Rhs>>
+constexpr bool fast_equal(std::span<Lhs, LhsExtent> lhs, std::span<Rhs, RhsExtent> rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    if constexpr (is_bitwise_equality_comparable_v<std::remove_cv_t<Lhs>>)
+    {
+        if !consteval
+        {
+            return lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size_bytes()) == 0;
+        }
+    }
+    for (size_t index = 0; index < lhs.size(); ++index)
+    {
+        if (!(lhs[index] == rhs[index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Trait to identify types whose objects can be hashed by their bytes: those with a unique object representation,
+ * which have no padding and no second representation of a value, so that equal values have equal bytes. The byte hash
+ * agrees with operator== where that compares the bytes (see is_bitwise_equality_comparable). Other types opt in by
+ * specialising this template.
+ */
+template <typename T> struct is_bitwise_hashable : std::bool_constant<std::has_unique_object_representations_v<T>>
+{
+};
+
+template <typename T> using is_bitwise_hashable_t = typename is_bitwise_hashable<T>::type;
+
+template <typename T> inline constexpr bool is_bitwise_hashable_v = is_bitwise_hashable<T>::value;
+
+namespace detail
+{
+/**
+ * @brief The 128-bit product of a and b: low half to a, high half to b.
+ */
+inline void multiply_wide(uint64_t& a, uint64_t& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+    uint128 const product       = static_cast<uint128>(a) * b;
+    a                           = static_cast<uint64_t>(product);
+    b                           = static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t const a_high = a >> 32;
+    uint64_t const a_low  = static_cast<uint32_t>(a);
+    uint64_t const b_high = b >> 32;
+    uint64_t const b_low  = static_cast<uint32_t>(b);
+    uint64_t const high   = a_high * b_high;
+    uint64_t const middle = a_high * b_low;
+    uint64_t const centre = a_low * b_high;
+    uint64_t const low    = a_low * b_low;
+    uint64_t const carry  = ((low >> 32) + static_cast<uint32_t>(middle) + static_cast<uint32_t>(centre)) >> 32;
+    a                     = a * b;
+    b                     = high + (middle >> 32) + (centre >> 32) + carry;
+#endif
+}
+
+/**
+ * @brief Multiply, then fold the 128-bit product to 64 bits.
+ */
+inline uint64_t mix_wide(uint64_t a, uint64_t b) noexcept
+{
+    multiply_wide(a, b);
+    return a ^ b;
+}
+
+inline uint64_t read_8(unsigned char const* bytes) noexcept
+{
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint64_t read_4(unsigned char const* bytes) noexcept
+{
+    uint32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// first, middle and last byte of 1 to 3 bytes
+inline uint64_t read_1_to_3(unsigned char const* bytes, size_t size) noexcept
+{
+    return (uint64_t{bytes[0]} << 16) | (uint64_t{bytes[size >> 1]} << 8) | bytes[size - 1];
+}
+
+inline constexpr uint64_t hash_secret[4] = {
+    0x2d35'8dcc'aa6c'78a5ULL, 0x8bb8'4b93'962e'acc9ULL, 0x4b33'a62e'd433'd4a3ULL, 0x4d5a'2da5'1de1'aa47ULL};
+
+/**
+ * @brief wyhash: 64-bit hash of size bytes in one pass, with 128-bit multiplications that consume 16 bytes each, on
+ * three independent lanes for inputs over 48 bytes. For a size known at compile time all branches fold away.
+ */
+inline uint64_t wyhash(void const* data, size_t size, uint64_t seed) noexcept
+{
+    auto const* bytes = static_cast<unsigned char const*>(data);
+    seed ^= mix_wide(seed ^ hash_secret[0], hash_secret[1]);
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            size_t const quarter = (size >> 3) << 2;
+            a                    = (read_4(bytes) << 32) | read_4(bytes + quarter);
+            b                    = (read_4(bytes + size - 4) << 32) | read_4(bytes + size - 4 - quarter);
+        }
+        else if (size > 0)
+        {
+            a = read_1_to_3(bytes, size);
+        }
+    }
+    else
+    {
+        size_t remaining = size;
+        if (remaining > 48)
+        {
+            uint64_t lane_1 = seed;
+            uint64_t lane_2 = seed;
+            do
+            {
+                seed   = mix_wide(read_8(bytes) ^ hash_secret[1], read_8(bytes + 8) ^ seed);
+                lane_1 = mix_wide(read_8(bytes + 16) ^ hash_secret[2], read_8(bytes + 24) ^ lane_1);
+                lane_2 = mix_wide(read_8(bytes + 32) ^ hash_secret[3], read_8(bytes + 40) ^ lane_2);
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane_1 ^ lane_2;
+        }
+        while (remaining > 16)
+        {
+            seed = mix_wide(read_8(bytes) ^ hash_secret[1], read_8(bytes + 8) ^ seed);
+            bytes += 16;
+            remaining -= 16;
+        }
+        a = read_8(bytes + remaining - 16);
+        b = read_8(bytes + remaining - 8);
+    }
+    a ^= hash_secret[1];
+    b ^= seed;
+    multiply_wide(a, b);
+    return mix_wide(a ^ hash_secret[0] ^ size, b ^ hash_secret[1]);
+}
+} // namespace detail
+
+/**
+ * @brief Hash of size bytes at data, in one pass with wyhash. The hash is the same on every run, and differs between
+ * seeds.
+ */
+inline size_t hash_bytes(void const* data, size_t size, uint64_t seed = 0) noexcept
+{
+    return static_cast<size_t>(detail::wyhash(data, size, seed));
+}
+
+/**
+ * @brief Hash of the object bytes of a bitwise hashable type, as a drop-in for std::hash in unordered containers of
+ * plain structs that have none, replacing per-member hash_combine.
+ *
+ * @code{.cpp}
+ * struct FlowKey
+ * {
+ *     std::uint32_t source;
+ *     std::uint32_t destination;
+ *     std::uint16_t source_port;
+ *     std::uint16_t destination_port;
+ *     std::uint32_t protocol;
+ *
+ *     bool operator==(FlowKey const&) const = default;
+ * };
+ * std::unordered_map<FlowKey, Counters, util::byte_hash<FlowKey>> flows;
+ * @endcode
+ */
+template <typename T>
+requires is_bitwise_hashable_v<T>
+struct byte_hash
+{
+    size_t operator()(T const& value) const noexcept
+    {
+        return hash_bytes(std::addressof(value), sizeof(T));
+    }
+};
+
+/**
+ * @brief Hash a batch of values into hashes, hashes[i] = byte_hash<T>{}(values[i]), for as many values as there are
+ * hashes. The hashes of different elements do not depend on each other, so the multiplications of several elements
+ * are in flight at once.
+ *
+ * @return std::span<size_t> the hashes written
+ */
+template <typename T, size_t Extent, size_t HashExtent>
+requires is_bitwise_hashable_v<std::remove_cv_t<T>>
+std::span<size_t> hash_many(std::span<T, Extent> values, std::span<size_t, HashExtent> hashes) noexcept
+{
+    size_t const count = std::min(values.size(), hashes.size());
+    for (size_t index = 0; index < count; ++index)
+    {
+        hashes[index] = hash_bytes(std::addressof(values[index]), sizeof(T));
+    }
+    return hashes.first(count);
+}
+
+} // namespace util
+
+#endif // BITWISE_H_INCLUDED
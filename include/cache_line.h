@@ -0,0 +1,203 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/cache_line.h
+ * Description: Cache-line size, layout traits to detect false sharing, and wrappers that give an object its own lines.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef CACHE_LINE_H_INCLUDED
+#define CACHE_LINE_H_INCLUDED
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+/**
+ * @brief Size in bytes of the unit of memory that two cores cannot write concurrently without contention: the
+ * definition of CACHE_LINE_SIZE if given, else std::hardware_destructive_interference_size where the standard library
+ * provides it, else 64. The standard value depends on the compiler's tuning flags; since every layout below depends on
+ * it, translation units sharing these types must agree on it, which defining CACHE_LINE_SIZE guarantees.
+ */
+#if defined(CACHE_LINE_SIZE)
+inline constexpr size_t cache_line_size_v = CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Winterference-size"
+    #endif
+inline constexpr size_t cache_line_size_v = std::hardware_destructive_interference_size;
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC diagnostic pop
+    #endif
+#else
+inline constexpr size_t cache_line_size_v = 64;
+#endif
+
+static_assert((cache_line_size_v & (cache_line_size_v - 1)) == 0, "the cache-line size must be a power of two");
+
+/**
+ * @brief Trait to identify types small enough to fit in one cache line when placed at the start of one.
+ */
+template <typename T> struct fits_in_cache_line : std::bool_constant<sizeof(T) <= cache_line_size_v>
+{
+};
+
+template <typename T> using fits_in_cache_line_t = typename fits_in_cache_line<T>::type;
+
+template <typename T> inline constexpr bool fits_in_cache_line_v = fits_in_cache_line<T>::value;
+
+/**
+ * @brief True if the data two of the N elements of an array T[N] write can lie (partly) in the same cache line, so that
+ * threads each writing their own element contend for it. Safe are elements aligned to whole cache lines, e.g.
+ * cache_aligned, and padded, whose padding may share lines with its neighbours but keeps its value apart from theirs.
+ *
+ * @code{.cpp}
+ * static_assert(util::shares_cache_line_v<std::atomic<long>, 8>);                       // false sharing
+ * static_assert(!util::shares_cache_line_v<util::cache_aligned<std::atomic<long>>, 8>); // one line each
+ * static_assert(!util::shares_cache_line_v<util::padded<std::atomic<long>>, 8>);        // one line each
+ * @endcode
+ */
+template <typename T, size_t N>
+struct shares_cache_line : std::bool_constant<(N > 1) && alignof(T) % cache_line_size_v != 0>
+{
+};
+
+template <typename T, size_t N> using shares_cache_line_t = typename shares_cache_line<T, N>::type;
+
+template <typename T, size_t N> inline constexpr bool shares_cache_line_v = shares_cache_line<T, N>::value;
+
+/**
+ * @brief Object aligned to the start of a cache line and padded to whole lines, so that no other object shares a line
+ * with it; e.g. per-thread counters or the head and tail of a queue. Heap allocation relies on the over-aligned
+ * operator new of C++17; where that is not available use padded.
+ *
+ * @code{.cpp}
+ * std::array<util::cache_aligned<std::atomic<long>>, 8> counters{};
+ * counters[thread_index]->fetch_add(1, std::memory_order_relaxed);
+ * @endcode
+ */
+template <typename T> struct alignas(cache_line_size_v) cache_aligned
+{
+    T value;
+
+    constexpr cache_aligned()
+    requires std::is_default_constructible_v<T>
+        : value()
+    {
+    }
+
+    template <typename... Args>
+    requires std::is_constructible_v<T, Args&&...>
+    constexpr explicit cache_aligned(std::in_place_t, Args&&... args)
+        : value(std::forward<Args>(args)...)
+    {
+    }
+
+    constexpr T& operator*() noexcept
+    {
+        return value;
+    }
+
+    constexpr T const& operator*() const noexcept
+    {
+        return value;
+    }
+
+    constexpr T* operator->() noexcept
+    {
+        return &value;
+    }
+
+    constexpr T const* operator->() const noexcept
+    {
+        return &value;
+    }
+};
+
+/**
+ * @brief Object with enough padding before and after it that no other object shares a cache line with it, without
+ * over-alignment: for allocators and containers that do not honour alignas. Costs up to two lines more than
+ * cache_aligned.
+ */
+template <typename T>
+requires(alignof(T) < cache_line_size_v)
+struct padded
+{
+  private:
+    // the line holding the byte before this object ends at most a line minus alignof(T) bytes after its start
+    std::byte leading_padding_[cache_line_size_v - alignof(T)]{};
+
+  public:
+    T value;
+
+  private:
+    // the line holding the last byte of value ends at most a line minus one byte after that byte
+    std::byte trailing_padding_[cache_line_size_v - 1]{};
+
+  public:
+    constexpr padded()
+    requires std::is_default_constructible_v<T>
+        : value()
+    {
+    }
+
+    template <typename... Args>
+    requires std::is_constructible_v<T, Args&&...>
+    constexpr explicit padded(std::in_place_t, Args&&... args)
+        : value(std::forward<Args>(args)...)
+    {
+    }
+
+    constexpr T& operator*() noexcept
+    {
+        return value;
+    }
+
+    constexpr T const& operator*() const noexcept
+    {
+        return value;
+    }
+
+    constexpr T* operator->() noexcept
+    {
+        return &value;
+    }
+
+    constexpr T const* operator->() const noexcept
+    {
+        return &value;
+    }
+};
+
+/**
+ * @brief The values of padded are apart by at least a cache line, only their padding shares lines.
+ */
+template <typename T, size_t N> struct shares_cache_line<padded<T>, N> : std::false_type
+{
+};
+
+} // namespace util
+
+#endif // CACHE_LINE_H_INCLUDED
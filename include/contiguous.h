@@ -0,0 +1,246 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/contiguous.h
+ * Description: Contiguous-range traits, and copying and comparison of ranges with memcpy/memcmp where they allow it.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef CONTIGUOUS_H_INCLUDED
+#define CONTIGUOUS_H_INCLUDED
+
+#include "bitwise.h"
+#include "traits.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Value type and contiguity of a type: string-likes as classified by string_classification, with character
+ * arrays and pointers up to their terminator; otherwise sized contiguous ranges such as std::vector, std::array,
+ * std::span and C arrays. std::vector<bool> and node-based containers are not contiguous.
+ */
+template <typename T, typename = void> struct contiguous_classification
+{
+    static constexpr bool value = false;
+};
+
+template <typename T>
+requires is_string_v<T>
+struct contiguous_classification<T>
+{
+    static constexpr bool value = true;
+    using value_type            = string_char_t<T>;
+};
+
+template <typename T>
+requires(!is_string_v<T> && std::ranges::contiguous_range<T> && std::ranges::sized_range<T>)
+struct contiguous_classification<T>
+{
+    static constexpr bool value = true;
+    using value_type            = std::ranges::range_value_t<T>;
+};
+} // namespace detail
+
+/**
+ * @brief Trait to identify types whose elements lie contiguously in memory: all string-likes, std::vector (but not
+ * std::vector<bool>), std::array, std::span, C arrays and any other sized contiguous range.
+ */
+template <typename T>
+struct is_contiguous_range : std::bool_constant<detail::contiguous_classification<std::remove_cvref_t<T>>::value>
+{
+};
+
+template <typename T> using is_contiguous_range_t = typename is_contiguous_range<T>::type;
+
+template <typename T> inline constexpr bool is_contiguous_range_v = is_contiguous_range<T>::value;
+
+/**
+ * @brief Element type of a contiguous range, without cv-qualification; the character type for string-likes.
+ */
+template <typename T>
+requires is_contiguous_range_v<T>
+using contiguous_value_t = typename detail::contiguous_classification<std::remove_cvref_t<T>>::value_type;
+
+/**
+ * @brief Trait to identify contiguous ranges of trivially copyable elements, which can be copied with memcpy.
+ */
+template <typename T, bool = is_contiguous_range_v<T>> struct is_trivially_copyable_range : std::false_type
+{
+};
+
+template <typename T>
+struct is_trivially_copyable_range<T, true> : std::bool_constant<std::is_trivially_copyable_v<contiguous_value_t<T>>>
+{
+};
+
+template <typename T> using is_trivially_copyable_range_t = typename is_trivially_copyable_range<T>::type;
+
+template <typename T> inline constexpr bool is_trivially_copyable_range_v = is_trivially_copyable_range<T>::value;
+
+/**
+ * @brief Read-only span over the elements of a contiguous range; string-likes up to their terminator (see
+ * as_string_view).
+ */
+template <typename T>
+requires is_contiguous_range_v<T>
+constexpr std::span<contiguous_value_t<T> const> as_span(T const& range)
+{
+    if constexpr (is_string_v<std::remove_cvref_t<T>>)
+    {
+        auto const view = as_string_view(range);
+        return {view.data(), view.size()};
+    }
+    else
+    {
+        return {std::ranges::data(range), std::ranges::size(range)};
+    }
+}
+
+/**
+ * @brief A source of elements for copy_into and equal_ranges: any input range, or a string-like.
+ */
+template <typename T>
+concept element_source = is_contiguous_range_v<T> || std::ranges::input_range<T const>;
+
+namespace detail
+{
+/**
+ * @brief The elements of a source as a range: contiguous ranges as span, so that strings end at their terminator.
+ */
+template <typename T> constexpr decltype(auto) elements_of(T const& source)
+{
+    if constexpr (is_contiguous_range_v<T>)
+    {
+        return as_span(source);
+    }
+    else
+    {
+        return (source);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Copy the elements of source to out, e.g. into a serialisation buffer. If source is a contiguous range of
+ * trivially copyable elements and out a contiguous iterator of the same element type, the copy is a single memcpy;
+ * otherwise the elements are assigned one by one. The destination must not overlap the source.
+ *
+ * @code{.cpp}
+ * std::vector<char> buffer(64);
+ * auto end = util::copy_into("header", buffer.begin()); // memcpy of 6 characters
+ * @endcode
+ *
+ * @param source range or string-like to copy
+ * @param out start of the destination
+ * @return Out the destination iterator past the last copied element
+ */
+template <typename Source, typename Out>
+requires element_source<Source>
+constexpr Out copy_into(Source const& source, Out out)
+{
+    if constexpr (is_trivially_copyable_range_v<Source> && std::contiguous_iterator<Out>)
+    {
+        using out_value_type = std::remove_reference_t<std::iter_reference_t<Out>>;
+        if constexpr (std::is_same_v<out_value_type, contiguous_value_t<Source>>)
+        {
+            auto const elements = as_span(source);
+            if !consteval
+            {
+                if (!elements.empty())
+                {
+                    std::memcpy(std::to_address(out), elements.data(), elements.size_bytes());
+                }
+                return out + static_cast<std::iter_difference_t<Out>>(elements.size());
+            }
+        }
+    }
+    for (auto const& element : detail::elements_of(source))
+    {
+        *out = element;
+        ++out;
+    }
+    return out;
+}
+
+/**
+ * @brief Element-wise equality of two ranges or string-likes of the same length. Contiguous ranges of the same bitwise
+ * equality comparable element type (see is_bitwise_equality_comparable) are compared with a single memcmp; all others
+ * element by element with operator==.
+ *
+ * @code{.cpp}
+ * util::equal_ranges(std::vector<int>{1, 2, 3}, std::array{1, 2, 3}); // true, one memcmp
+ * util::equal_ranges(std::string("abc"), "abc");                     // true
+ * @endcode
+ */
+template <typename Lhs, typename Rhs>
+requires element_source<Lhs> && element_source<Rhs>
+constexpr bool equal_ranges(Lhs const& lhs, Rhs const& rhs)
+{
+    if constexpr (is_contiguous_range_v<Lhs> && is_contiguous_range_v<Rhs>)
+    {
+        using value_type = contiguous_value_t<Lhs>;
+        if constexpr (std::is_same_v<value_type, contiguous_value_t<Rhs>> &&
+                      is_bitwise_equality_comparable_v<value_type>)
+        {
+            auto const lhs_elements = as_span(lhs);
+            auto const rhs_elements = as_span(rhs);
+            if !consteval
+            {
+                return lhs_elements.size() == rhs_elements.size() &&
+                       (lhs_elements.empty() ||
+                        std::memcmp(lhs_elements.data(), rhs_elements.data(), lhs_elements.size_bytes()) == 0);
+            }
+        }
+    }
+    auto&& lhs_elements = detail::elements_of(lhs);
+    auto&& rhs_elements = detail::elements_of(rhs);
+    if constexpr (std::ranges::sized_range<decltype(lhs_elements)> && std::ranges::sized_range<decltype(rhs_elements)>)
+    {
+        if (std::ranges::size(lhs_elements) != std::ranges::size(rhs_elements))
+        {
+            return false;
+        }
+    }
+    auto lhs_it = std::ranges::begin(lhs_elements);
+    auto rhs_it = std::ranges::begin(rhs_elements);
+    for (; lhs_it != std::ranges::end(lhs_elements) && rhs_it != std::ranges::end(rhs_elements); ++lhs_it, ++rhs_it)
+    {
+        if (!(*lhs_it == *rhs_it))
+        {
+            return false;
+        }
+    }
+    return lhs_it == std::ranges::end(lhs_elements) && rhs_it == std::ranges::end(rhs_elements);
+}
+
+} // namespace util
+
+#endif // CONTIGUOUS_H_INCLUDED
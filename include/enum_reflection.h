@@ -0,0 +1,347 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/enum_reflection.h
+ * Description: Compile-time reflection of enumerators: count, values, names and constant-time name look-ups.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef ENUM_REFLECTION_H_INCLUDED
+#define ENUM_REFLECTION_H_INCLUDED
+
+#include "string_switch.h"
+#include "traits.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+template <typename E>
+concept is_enum_c = std::is_enum_v<E>;
+
+/**
+ * @brief Trait to identify enumerations with a fixed underlying type: scoped enumerations and unscoped ones declared
+ * with one, as in "enum flags : uint8_t". Only they can be direct-list-initialised from their underlying type, and only
+ * they hold every value of it; the values of others are limited to the smallest bit-field holding their enumerators.
+ */
+template <typename E, typename = void> struct has_fixed_underlying_type : std::false_type
+{
+};
+
+template <typename E>
+struct has_fixed_underlying_type<E, std::void_t<decltype(E{std::declval<std::underlying_type_t<E>>()})>>
+    : std::is_enum<E>
+{
+};
+
+template <typename E> using has_fixed_underlying_type_t = typename has_fixed_underlying_type<E>::type;
+
+template <typename E> inline constexpr bool has_fixed_underlying_type_v = has_fixed_underlying_type<E>::value;
+
+/**
+ * @brief Enumerations whose enumerators can be reflected: those with a fixed underlying type. The others are excluded
+ * because converting a value outside their bit-field range to them, as searching enum_range does, is undefined and not
+ * a constant expression (clang rejects it); give them an underlying type to reflect them.
+ */
+template <typename E>
+concept is_reflectable_enum_c = is_enum_c<E> && has_fixed_underlying_type_v<E>;
+
+/**
+ * @brief Range of underlying values searched for the enumerators of E, clipped to the range of its underlying type.
+ * Specialise for enums with enumerators outside [-128, 127]; the compile time grows with the size of the range.
+ *
+ * @code{.cpp}
+ * template <> struct util::enum_range<http_status>
+ * {
+ *     static constexpr int min = 100;
+ *     static constexpr int max = 599;
+ * };
+ * @endcode
+ */
+template <typename E>
+requires is_reflectable_enum_c<E>
+struct enum_range
+{
+    static constexpr int min = -128;
+    static constexpr int max = 127;
+};
+
+namespace detail
+{
+/**
+ * @brief Signature of this function as spelled by the compiler, without the text that follows the value of V. The
+ * return type is deduced, or GCC would spell out the alias std::string_view after V.
+ */
+template <typename E, E V> constexpr auto enumerator_signature()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::string_view signature = __FUNCSIG__;
+    signature.remove_suffix(sizeof(">(void)") - 1);
+#else
+    std::string_view signature = __PRETTY_FUNCTION__;
+    signature.remove_suffix(sizeof("]") - 1);
+#endif
+    return signature;
+}
+
+/**
+ * @brief Name of the enumerator V of E, without qualification; empty if no enumerator has the value V, in which case
+ * the compilers spell the value as a (cast) number.
+ */
+template <typename E, E V> constexpr std::string_view enumerator_name()
+{
+    std::string_view const signature = enumerator_signature<E, V>();
+    size_t                 start     = signature.size();
+    while (start > 0 && (signature[start - 1] == '_' || (signature[start - 1] >= '0' && signature[start - 1] <= '9') ||
+                         (signature[start - 1] >= 'a' && signature[start - 1] <= 'z') ||
+                         (signature[start - 1] >= 'A' && signature[start - 1] <= 'Z')))
+    {
+        --start;
+    }
+    std::string_view const name = signature.substr(start);
+    return name.empty() || (name[0] >= '0' && name[0] <= '9') ? std::string_view{} : name;
+}
+
+/**
+ * @brief Copy of the name of the enumerator V that outlives constant evaluation.
+ */
+template <typename E, E V> struct enumerator_name_storage
+{
+    static constexpr auto chars = []
+    {
+        constexpr std::string_view name = enumerator_name<E, V>();
+        std::array<char, name.size() + 1> copy{};
+        for (size_t index = 0; index < name.size(); ++index)
+        {
+            copy[index] = name[index];
+        }
+        return copy;
+    }();
+
+    static constexpr std::string_view value{chars.data(), chars.size() - 1};
+};
+
+/**
+ * @brief Smallest unsigned type holding the values 0 to Max.
+ */
+template <size_t Max>
+using least_index_t = std::conditional_t<
+    (Max <= std::numeric_limits<uint8_t>::max()),
+    uint8_t,
+    std::conditional_t<(Max <= std::numeric_limits<uint16_t>::max()), uint16_t, size_t>>;
+
+/**
+ * @brief A value of an underlying type as long long or unsigned long long, which the std::cmp_* functions accept; they
+ * reject the character types and bool, which can underlie an enumeration too.
+ */
+template <typename T> constexpr auto widen(T value) noexcept
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<long long>(value);
+    }
+    else
+    {
+        return static_cast<unsigned long long>(value);
+    }
+}
+
+/**
+ * @brief The reflected enumerators of E: every value of the searched range that names an enumerator, in ascending
+ * order, and a dense table from the values of the range to their position among the enumerators.
+ */
+template <typename E> struct enum_reflection
+{
+    using underlying_type = std::underlying_type_t<E>;
+    using limits_type     = std::numeric_limits<underlying_type>;
+
+    static constexpr int first = std::cmp_less(enum_range<E>::min, widen(limits_type::min()))
+                                     ? static_cast<int>(limits_type::min())
+                                     : enum_range<E>::min;
+    static constexpr int last  = std::cmp_greater(enum_range<E>::max, widen(limits_type::max()))
+                                     ? static_cast<int>(limits_type::max())
+                                     : enum_range<E>::max;
+    static_assert(first <= last, "util::enum_range must not be empty");
+
+    static constexpr size_t range_size = static_cast<size_t>(last - first) + 1;
+
+    static constexpr std::array<bool, range_size> is_enumerator = []<size_t... Offsets>(std::index_sequence<Offsets...>)
+    {
+        return std::array<bool, range_size>{
+            !enumerator_name<E, static_cast<E>(first + static_cast<int>(Offsets))>().empty()...};
+    }(std::make_index_sequence<range_size>{});
+
+    static constexpr size_t count = []
+    {
+        size_t enumerators = 0;
+        for (bool const flag : is_enumerator)
+        {
+            enumerators += flag ? 1 : 0;
+        }
+        return enumerators;
+    }();
+
+    static constexpr std::array<E, count> values = []
+    {
+        std::array<E, count> enumerators{};
+        size_t               position = 0;
+        for (size_t offset = 0; offset < range_size; ++offset)
+        {
+            if (is_enumerator[offset])
+            {
+                enumerators[position++] = static_cast<E>(first + static_cast<int>(offset));
+            }
+        }
+        return enumerators;
+    }();
+
+    static constexpr std::array<std::string_view, count> names = []<size_t... Positions>(
+        std::index_sequence<Positions...>)
+    {
+        return std::array<std::string_view, count>{enumerator_name_storage<E, values[Positions]>::value...};
+    }(std::make_index_sequence<count>{});
+
+    // position of the enumerator with the value first + offset, count where there is none
+    using index_type = least_index_t<count>;
+
+    static constexpr std::array<index_type, range_size> position_of = []
+    {
+        std::array<index_type, range_size> positions{};
+        size_t                             position = 0;
+        for (size_t offset = 0; offset < range_size; ++offset)
+        {
+            positions[offset] = static_cast<index_type>(is_enumerator[offset] ? position++ : count);
+        }
+        return positions;
+    }();
+
+    static constexpr auto name_hash = []
+    {
+        if constexpr (count == 0)
+        {
+            return perfect_hash<0>{};
+        }
+        else
+        {
+            std::array<uint64_t, count> hashes{};
+            for (size_t position = 0; position < count; ++position)
+            {
+                hashes[position] = fnv1a(names[position]);
+            }
+            return make_perfect_hash<count>(hashes);
+        }
+    }();
+};
+} // namespace detail
+
+/**
+ * @brief Number of enumerators of E with distinct values within enum_range<E>.
+ */
+template <typename E>
+requires is_reflectable_enum_c<E>
+struct enum_count : std::integral_constant<size_t, detail::enum_reflection<E>::count>
+{
+};
+
+template <typename E> using enum_count_t = typename enum_count<E>::type;
+
+template <typename E> inline constexpr size_t enum_count_v = enum_count<E>::value;
+
+/**
+ * @brief The enumerators of E with distinct values within enum_range<E>, in ascending order of value.
+ */
+template <typename E>
+requires is_reflectable_enum_c<E>
+inline constexpr std::array<E, enum_count_v<E>> const& enum_values_v = detail::enum_reflection<E>::values;
+
+/**
+ * @brief The unqualified names of the enumerators in enum_values_v<E>, in the same order. Of enumerators sharing a
+ * value only one is named.
+ */
+template <typename E>
+requires is_reflectable_enum_c<E>
+inline constexpr std::array<std::string_view, enum_count_v<E>> const& enum_names_v = detail::enum_reflection<E>::names;
+
+/**
+ * @brief Name of the enumerator with the value of value, empty if there is none; a look-up in a dense table.
+ *
+ * @code{.cpp}
+ * enum class level { debug, info, warning, error };
+ * static_assert(util::enum_name(level::warning) == "warning");
+ * @endcode
+ */
+template <typename E>
+requires is_reflectable_enum_c<E>
+constexpr std::string_view enum_name(E value) noexcept
+{
+    using reflection_type = detail::enum_reflection<E>;
+
+    auto const underlying = static_cast<typename reflection_type::underlying_type>(value);
+    if (std::cmp_less(detail::widen(underlying), reflection_type::first) ||
+        std::cmp_greater(detail::widen(underlying), reflection_type::last))
+    {
+        return {};
+    }
+    size_t const position = reflection_type::position_of[static_cast<size_t>(underlying - reflection_type::first)];
+    return position == reflection_type::count ? std::string_view{} : reflection_type::names[position];
+}
+
+/**
+ * @brief The enumerator of E named str, if any, from any string-like of char. The names are matched exactly, with a
+ * minimal perfect hash computed at compile time: one hash of str and one comparison, and no allocation.
+ *
+ * @code{.cpp}
+ * std::optional<level> parsed = util::enum_from_string<level>(config_value); // e.g. a std::string_view
+ * @endcode
+ */
+template <typename E, typename T>
+requires is_reflectable_enum_c<E> && is_compatible_string_v<T, std::string_view>
+constexpr std::optional<E> enum_from_string(T const& str) noexcept
+{
+    using reflection_type = detail::enum_reflection<E>;
+
+    if constexpr (reflection_type::count == 0)
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        constexpr auto const&  table    = reflection_type::name_hash;
+        std::string_view const view     = as_string_view(str);
+        size_t const           position = table.key_at[table.slot_of(detail::fnv1a(view))];
+        if (reflection_type::names[position] != view)
+        {
+            return std::nullopt;
+        }
+        return reflection_type::values[position];
+    }
+}
+
+} // namespace util
+
+#endif // ENUM_REFLECTION_H_INCLUDED
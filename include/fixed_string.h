@@ -0,0 +1,169 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/fixed_string.h
+ * Description: Fixed-size string literal type, usable as non-type template argument.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef FIXED_STRING_H_INCLUDED
+#define FIXED_STRING_H_INCLUDED
+
+#include "traits.h"
+
+#include <compare>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace util
+{
+
+/**
+ * @brief String of N characters held by value, with a terminator. It is a structural literal type, so string literals
+ * can be passed as template arguments; the size is deduced from the literal. It is a string-like (is_string), so it
+ * works with as_string_view, the comparators, hashing and concatenation.
+ *
+ * @code{.cpp}
+ * template <util::fixed_string Name> struct field
+ * {
+ *     static constexpr std::string_view name = Name;
+ * };
+ * using user_id = field<"user_id">;
+ * @endcode
+ *
+ * @tparam N number of characters, without the terminator
+ * @tparam CharT character type
+ */
+template <size_t N, typename CharT = char>
+requires is_char_v<CharT>
+struct fixed_string
+{
+    using value_type     = CharT;
+    using size_type      = size_t;
+    using const_iterator = CharT const*;
+
+    // public, as a structural type requires
+    CharT chars[N + 1]{};
+
+    constexpr fixed_string() = default;
+
+    constexpr fixed_string(CharT const (&str)[N + 1]) noexcept
+    {
+        for (size_t index = 0; index < N; ++index)
+        {
+            chars[index] = str[index];
+        }
+    }
+
+    static constexpr size_t size() noexcept
+    {
+        return N;
+    }
+
+    static constexpr bool empty() noexcept
+    {
+        return N == 0;
+    }
+
+    constexpr CharT const* data() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr CharT const* c_str() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return chars + N;
+    }
+
+    constexpr CharT operator[](size_t index) const noexcept
+    {
+        return chars[index];
+    }
+
+    constexpr std::basic_string_view<CharT> view() const noexcept
+    {
+        return {chars, N};
+    }
+
+    constexpr operator std::basic_string_view<CharT>() const noexcept
+    {
+        return view();
+    }
+
+    template <size_t M> constexpr bool operator==(fixed_string<M, CharT> const& other) const noexcept
+    {
+        return view() == other.view();
+    }
+
+    template <size_t M> constexpr auto operator<=>(fixed_string<M, CharT> const& other) const noexcept
+    {
+        return view() <=> other.view();
+    }
+
+    constexpr bool operator==(std::basic_string_view<CharT> other) const noexcept
+    {
+        return view() == other;
+    }
+};
+
+template <typename CharT, size_t N> fixed_string(CharT const (&)[N]) -> fixed_string<N - 1, CharT>;
+
+/**
+ * @brief String classification. Specialization for "util::fixed_string".
+ */
+template <size_t N, typename CharT> struct string_classification<fixed_string<N, CharT>>
+{
+    static constexpr string_kind kind = string_kind::fixed_string;
+    using char_type                   = CharT;
+};
+
+/**
+ * @brief Compile-time size of a string-like. Specialization for "util::fixed_string".
+ */
+template <size_t N, typename CharT> struct static_extent<fixed_string<N, CharT>> : std::integral_constant<size_t, N>
+{
+};
+
+/**
+ * @brief Trait to identify fixed strings: true for "util::fixed_string".
+ */
+template <typename T> struct is_fixed_string : detail::is_string_of_kind<T, string_kind::fixed_string>
+{
+};
+
+template <typename T> using is_fixed_string_t = typename is_fixed_string<T>::type;
+
+template <typename T> bool constexpr is_fixed_string_v = string_kind_v<T> == string_kind::fixed_string;
+
+} // namespace util
+
+#endif // FIXED_STRING_H_INCLUDED
@@ -0,0 +1,297 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/packed_tuple.h
+ * Description: Tuple that stores its elements by descending alignment to avoid padding, and a padding trait.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef PACKED_TUPLE_H_INCLUDED
+#define PACKED_TUPLE_H_INCLUDED
+
+#include "relocate.h"
+#include "traits.h"
+#include "type_list.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Bytes of padding in a struct declaring members of the types Ts in this order: every member is placed at the
+ * next multiple of its alignment, and the size is rounded up to the largest alignment.
+ */
+template <typename... Ts> constexpr size_t padding_in_order()
+{
+    if constexpr (sizeof...(Ts) == 0)
+    {
+        return 0;
+    }
+    else
+    {
+        constexpr std::array<size_t, sizeof...(Ts)> sizes{sizeof(Ts)...};
+        constexpr std::array<size_t, sizeof...(Ts)> alignments{alignof(Ts)...};
+        size_t                                      offset    = 0;
+        size_t                                      data      = 0;
+        size_t                                      alignment = 1;
+        for (size_t index = 0; index < sizeof...(Ts); ++index)
+        {
+            offset = (offset + alignments[index] - 1) / alignments[index] * alignments[index] + sizes[index];
+            data += sizes[index];
+            alignment = alignments[index] > alignment ? alignments[index] : alignment;
+        }
+        return (offset + alignment - 1) / alignment * alignment - data;
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Bytes of padding the compiler inserts into a struct whose members have the types Ts, declared in this order.
+ *
+ * @code{.cpp}
+ * static_assert(util::padding_bytes_v<bool, std::int64_t, char> == 14); // 24 bytes for 10 bytes of data
+ * static_assert(util::padding_bytes_v<std::int64_t, bool, char> == 6);  // 16 bytes
+ * @endcode
+ */
+template <typename... Ts> struct padding_bytes : std::integral_constant<size_t, detail::padding_in_order<Ts...>()>
+{
+};
+
+template <typename... Ts> using padding_bytes_t = typename padding_bytes<Ts...>::type;
+
+template <typename... Ts> inline constexpr size_t padding_bytes_v = padding_bytes<Ts...>::value;
+
+namespace detail
+{
+/**
+ * @brief Storage order of a packed_tuple: slot S holds element order[S]; element I lives in slot slot_of[I].
+ */
+template <typename... Ts> struct packed_layout
+{
+    static constexpr std::array<size_t, sizeof...(Ts)> order =
+        sort_positions<align_of, std::greater<>, Ts...>::value;
+
+    static constexpr std::array<size_t, sizeof...(Ts)> slot_of = []
+    {
+        std::array<size_t, sizeof...(Ts)> slots{};
+        for (size_t slot = 0; slot < sizeof...(Ts); ++slot)
+        {
+            slots[order[slot]] = slot;
+        }
+        return slots;
+    }();
+};
+
+/**
+ * @brief One element of a packed_tuple. The slot number keeps the bases of packed_storage distinct when element types
+ * repeat.
+ */
+template <size_t Slot, typename T> struct packed_slot
+{
+    [[no_unique_address]] T value;
+
+    constexpr packed_slot()
+    requires std::is_default_constructible_v<T>
+        : value()
+    {
+    }
+
+    template <typename U>
+    constexpr packed_slot(std::in_place_t, U&& initial)
+        : value(std::forward<U>(initial))
+    {
+    }
+};
+
+/**
+ * @brief The slots of a packed_tuple as base classes, in storage order, which the Itanium and MSVC ABIs both lay out in
+ * declaration order.
+ */
+template <typename Layout, typename Slots, typename... Ts> struct packed_storage;
+
+template <typename Layout, size_t... Slots, typename... Ts>
+struct packed_storage<Layout, std::index_sequence<Slots...>, Ts...>
+    : packed_slot<Slots, get_Nth_type_t<Layout::order[Slots], Ts...>>...
+{
+    constexpr packed_storage() = default;
+
+    // args holds the constructor arguments in element order, as forwarding references
+    template <typename Args>
+    constexpr explicit packed_storage(std::in_place_t, Args&& args)
+        : packed_slot<Slots, get_Nth_type_t<Layout::order[Slots], Ts...>>(
+              std::in_place, std::get<Layout::order[Slots]>(std::move(args)))...
+    {
+    }
+};
+} // namespace detail
+
+/**
+ * @brief Tuple of object types that stores its elements by descending alignment, so that no padding is needed between
+ * them, while get<I>, structured bindings, std::tuple_size and std::tuple_element keep the declared element order. For
+ * large tables of mixed tuples this can save a third of the memory:
+ *
+ * @code{.cpp}
+ * static_assert(sizeof(std::tuple<bool, std::int64_t, char>) == 24);
+ * static_assert(sizeof(util::packed_tuple<bool, std::int64_t, char>) == 16); // stored as int64_t, bool, char
+ *
+ * util::packed_tuple<bool, std::int64_t, char> row{true, 42, 'x'};
+ * auto [valid, id, code] = row;
+ * @endcode
+ */
+template <typename... Ts>
+requires(std::is_object_v<Ts> && ...)
+class packed_tuple
+{
+    using layout_type = detail::packed_layout<Ts...>;
+
+  public:
+    template <size_t I> using element_type = get_Nth_type_t<I, Ts...>;
+
+    // the elements are as relocatable as their types
+    using trivially_relocatable = relocatable_if<packed_tuple, all_trivially_relocatable_v<Ts...>>;
+
+    constexpr packed_tuple() = default;
+
+    template <typename... Us>
+    requires(sizeof...(Us) == sizeof...(Ts) && sizeof...(Ts) > 0 &&
+             !(sizeof...(Us) == 1 && (std::is_same_v<std::remove_cvref_t<Us>, packed_tuple> && ...)) &&
+             (std::is_constructible_v<Ts, Us &&> && ...))
+    constexpr explicit(!(std::is_convertible_v<Us &&, Ts> && ...)) packed_tuple(Us&&... args)
+        : storage_(std::in_place, std::forward_as_tuple(std::forward<Us>(args)...))
+    {
+    }
+
+    template <size_t I>
+    requires(I < sizeof...(Ts))
+    constexpr element_type<I>& get() & noexcept
+    {
+        return slot<I>(storage_).value;
+    }
+
+    template <size_t I>
+    requires(I < sizeof...(Ts))
+    constexpr element_type<I> const& get() const& noexcept
+    {
+        return slot<I>(storage_).value;
+    }
+
+    template <size_t I>
+    requires(I < sizeof...(Ts))
+    constexpr element_type<I>&& get() && noexcept
+    {
+        return std::move(slot<I>(storage_).value);
+    }
+
+    template <size_t I>
+    requires(I < sizeof...(Ts))
+    constexpr element_type<I> const&& get() const&& noexcept
+    {
+        return std::move(slot<I>(storage_).value);
+    }
+
+    /**
+     * @brief Element-wise equality in declared order.
+     */
+    friend constexpr bool operator==(packed_tuple const& lhs, packed_tuple const& rhs)
+    requires(equality_comparable<Ts> && ...)
+    {
+        return [&]<size_t... Is>(std::index_sequence<Is...>)
+        {
+            return ((lhs.template get<Is>() == rhs.template get<Is>()) && ...);
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+  private:
+    using storage_type = detail::packed_storage<layout_type, std::index_sequence_for<Ts...>, Ts...>;
+
+    // the base class of the storage that holds element I
+    template <size_t I, typename Storage> static constexpr auto& slot(Storage& storage) noexcept
+    {
+        using slot_type = detail::packed_slot<layout_type::slot_of[I], element_type<I>>;
+        if constexpr (std::is_const_v<Storage>)
+        {
+            return static_cast<slot_type const&>(storage);
+        }
+        else
+        {
+            return static_cast<slot_type&>(storage);
+        }
+    }
+
+    storage_type storage_;
+};
+
+template <typename... Ts> packed_tuple(Ts...) -> packed_tuple<Ts...>;
+
+template <typename> struct is_packed_tuple : std::false_type
+{
+};
+
+template <typename... Ts> struct is_packed_tuple<packed_tuple<Ts...>> : std::true_type
+{
+};
+
+template <typename T> using is_packed_tuple_t = typename is_packed_tuple<T>::type;
+
+template <typename T> inline constexpr bool is_packed_tuple_v = is_packed_tuple<T>::value;
+
+/**
+ * @brief Element I of a packed_tuple, like std::get for std::tuple; found by argument-dependent lookup.
+ */
+template <size_t I, typename Tuple>
+requires is_packed_tuple_v<std::remove_cvref_t<Tuple>>
+constexpr decltype(auto) get(Tuple&& tuple) noexcept
+{
+    return std::forward<Tuple>(tuple).template get<I>();
+}
+
+/**
+ * @brief A packed_tuple is a tuple: only its storage order differs.
+ */
+template <typename... Ts> struct is_tuple<packed_tuple<Ts...>> : std::true_type
+{
+};
+
+template <typename... Ts> struct type_list_from_tuple<packed_tuple<Ts...>>
+{
+    using type = type_list<Ts...>;
+};
+
+} // namespace util
+
+template <typename... Ts>
+struct std::tuple_size<util::packed_tuple<Ts...>> : std::integral_constant<size_t, sizeof...(Ts)>
+{
+};
+
+template <size_t I, typename... Ts> struct std::tuple_element<I, util::packed_tuple<Ts...>>
+{
+    using type = util::get_Nth_type_t<I, Ts...>;
+};
+
+#endif // PACKED_TUPLE_H_INCLUDED
@@ -0,0 +1,248 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/relocate.h
+ * Description: Trivial-relocatability trait and relocation of objects between uninitialised storage.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef RELOCATE_H_INCLUDED
+#define RELOCATE_H_INCLUDED
+
+#include "traits.h"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace util
+{
+
+/**
+ * @brief The value of the member typedef "trivially_relocatable" through which a class opts in to (or out of)
+ * trivial relocation. The typedef names the class that declares it, so that a derived class - which inherits the
+ * typedef, but may add members that are not relocatable - is not mistaken for having opted in.
+ *
+ * @tparam Class the class declaring the typedef
+ * @tparam condition whether Class is trivially relocatable
+ */
+template <typename Class, bool condition = true> struct relocatable_if : std::bool_constant<condition>
+{
+    using class_type = Class;
+};
+
+namespace detail
+{
+/**
+ * @brief Member-typedef hook: a class declaring "using trivially_relocatable = util::relocatable_if<Class, cond>;"
+ * states whether it is trivially relocatable. A typedef inherited from a base class names the base and is ignored.
+ */
+template <typename T, typename = void> struct relocatable_member_hook : std::false_type
+{
+};
+
+template <typename T>
+struct relocatable_member_hook<T, std::void_t<typename T::trivially_relocatable::class_type>>
+    : std::bool_constant<std::is_same_v<typename T::trivially_relocatable::class_type, std::remove_cv_t<T>> &&
+                         T::trivially_relocatable::value>
+{
+};
+} // namespace detail
+
+/**
+ * @brief Trait to identify types whose objects can be relocated - moved to new storage and the source destroyed - by
+ * copying their bytes. True for trivially copyable types and for classes opting in through the member typedef
+ * "trivially_relocatable" (see relocatable_if); other types opt in by specialising this template. Everything else is
+ * conservatively false.
+ *
+ * @code{.cpp}
+ * struct Record
+ * {
+ *     using trivially_relocatable =
+ *         util::relocatable_if<Record, util::all_trivially_relocatable_v<std::unique_ptr<char[]>, std::size_t>>;
+ *     std::unique_ptr<char[]> data;
+ *     std::size_t             size;
+ * };
+ * @endcode
+ */
+template <typename T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_copyable_v<T> || detail::relocatable_member_hook<T>::value>
+{
+};
+
+template <typename T> using is_trivially_relocatable_t = typename is_trivially_relocatable<T>::type;
+
+template <typename T> inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/**
+ * @brief True if all of the types are trivially relocatable; meant for composing the member-typedef hook of an
+ * aggregate from the types of its members.
+ */
+template <typename... Ts> using all_trivially_relocatable = std::conjunction<is_trivially_relocatable<Ts>...>;
+
+template <typename... Ts> inline constexpr bool all_trivially_relocatable_v = all_trivially_relocatable<Ts...>::value;
+
+/**
+ * @brief Arrays relocate like their elements.
+ */
+template <typename T, size_t sz> struct is_trivially_relocatable<T[sz]> : is_trivially_relocatable<T>
+{
+};
+
+/**
+ * @brief Pairs and tuples relocate like their members.
+ */
+template <typename T1, typename T2>
+struct is_trivially_relocatable<std::pair<T1, T2>> : all_trivially_relocatable<T1, T2>
+{
+};
+
+template <typename... Ts> struct is_trivially_relocatable<std::tuple<Ts...>> : all_trivially_relocatable<Ts...>
+{
+};
+
+// Standard library types that hold no pointers into themselves, limited to the standard libraries whose layout is
+// known. libstdc++'s std::basic_string is deliberately absent: its short-string buffer is addressed through a pointer
+// to the object itself.
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+template <typename T> struct is_trivially_relocatable<std::unique_ptr<T, std::default_delete<T>>> : std::true_type
+{
+};
+
+template <typename T> struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type
+{
+};
+
+template <typename T> struct is_trivially_relocatable<std::vector<T, std::allocator<T>>> : std::true_type
+{
+};
+#endif
+
+#if defined(_LIBCPP_VERSION)
+template <typename CharT>
+requires is_char_v<CharT>
+struct is_trivially_relocatable<std::basic_string<CharT, std::char_traits<CharT>, std::allocator<CharT>>>
+    : std::true_type
+{
+};
+#endif
+
+/**
+ * @brief Relocate count objects from first to the uninitialised storage at d_first: afterwards the objects live at
+ * d_first and the source storage is uninitialised. Trivially relocatable types are moved with a single memmove;
+ * others are move-constructed and destroyed one by one. The ranges may overlap in either direction.
+ *
+ * If a move constructor throws, the objects already relocated and those not yet relocated are destroyed before the
+ * exception propagates, so that neither range holds live objects.
+ *
+ * @param first start of the objects to relocate
+ * @param count number of objects
+ * @param d_first start of the uninitialised destination storage
+ * @return T* the end of the destination range
+ */
+template <typename T>
+T* uninitialized_relocate_n(T* first, size_t count, T* d_first) noexcept(is_trivially_relocatable_v<T> ||
+                                                                         std::is_nothrow_move_constructible_v<T>)
+{
+    static_assert(!std::is_const_v<T>, "const objects cannot be relocated");
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        if (count > 0)
+        {
+            std::memmove(static_cast<void*>(d_first), static_cast<void const*>(first), count * sizeof(T));
+        }
+        return d_first + count;
+    }
+    else
+    {
+        if (first == d_first || count == 0)
+        {
+            return d_first + count;
+        }
+        // walk away from the overlap so that no source object is overwritten before it has been relocated
+        bool const forward      = d_first < first;
+        size_t     done         = 0;
+        auto const relocate_all = [&]
+        {
+            for (; done < count; ++done)
+            {
+                size_t const index = forward ? done : count - 1 - done;
+                ::new (static_cast<void*>(d_first + index)) T(std::move(first[index]));
+                first[index].~T();
+            }
+        };
+        if constexpr (std::is_nothrow_move_constructible_v<T>)
+        {
+            relocate_all();
+        }
+        else
+        {
+            try
+            {
+                relocate_all();
+            }
+            catch (...)
+            {
+                // the first done objects live in the destination, the rest - the one that threw included - in the
+                // source
+                for (size_t cleaned = 0; cleaned < count; ++cleaned)
+                {
+                    size_t const index = forward ? cleaned : count - 1 - cleaned;
+                    (cleaned < done ? d_first : first)[index].~T();
+                }
+                throw;
+            }
+        }
+        return d_first + count;
+    }
+}
+
+/**
+ * @brief Relocate the objects of [first, last) to the uninitialised storage at d_first; see uninitialized_relocate_n.
+ *
+ * @return T* the end of the destination range
+ */
+template <typename T>
+T* relocate(T* first, T* last, T* d_first) noexcept(noexcept(uninitialized_relocate_n(first, size_t{}, d_first)))
+{
+    return uninitialized_relocate_n(first, static_cast<size_t>(last - first), d_first);
+}
+
+/**
+ * @brief Relocate a single object from source to the uninitialised storage at dest.
+ *
+ * @return T* dest, now holding the object
+ */
+template <typename T> T* relocate_at(T* source, T* dest) noexcept(noexcept(uninitialized_relocate_n(source, 1, dest)))
+{
+    uninitialized_relocate_n(source, 1, dest);
+    return dest;
+}
+
+} // namespace util
+
+#endif // RELOCATE_H_INCLUDED
@@ -0,0 +1,757 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/simd_scan.h
+ * Description: Vectorised scans over character sequences with runtime CPU dispatch.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef SIMD_SCAN_H_INCLUDED
+#define SIMD_SCAN_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// The kernels use the GCC/Clang vector extensions and x86 builtins directly rather than <immintrin.h>, which would
+// add a noticeable parse cost to every translation unit including traits.h.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define SIMD_SCAN_X86 1
+#endif
+
+#if defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define SIMD_SCAN_NO_SANITIZE __attribute__((no_sanitize_address))
+    #endif
+#endif
+#if !defined(SIMD_SCAN_NO_SANITIZE) && defined(__SANITIZE_ADDRESS__)
+    #define SIMD_SCAN_NO_SANITIZE __attribute__((no_sanitize_address))
+#endif
+#if !defined(SIMD_SCAN_NO_SANITIZE)
+    #define SIMD_SCAN_NO_SANITIZE
+#endif
+
+namespace util::simd
+{
+
+/**
+ * @brief Instruction-set levels the kernels are available for, in ascending order.
+ */
+enum class isa : std::uint8_t
+{
+    scalar,
+    sse2,
+    avx2,
+    avx512
+};
+
+/**
+ * @brief Best instruction set supported by the executing CPU (AVX-512 requires the F and BW extensions).
+ */
+inline isa detected_isa() noexcept
+{
+#if defined(SIMD_SCAN_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return isa::avx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return isa::sse2;
+    }
+#endif
+    return isa::scalar;
+}
+
+/**
+ * @brief Instruction set used by the dispatching functions; detected once per process.
+ */
+inline isa active_isa() noexcept
+{
+    static isa const detected = detected_isa();
+    return detected;
+}
+
+namespace detail
+{
+/**
+ * @brief Signature shared by all kernels: scan at most limit code units of Unit bytes starting at str.
+ */
+using scan_kernel = size_t (*)(void const* str, size_t limit) noexcept;
+
+/**
+ * @brief Signature shared by the prefix kernels: count the leading code units below bound in [str, str + size).
+ */
+using prefix_kernel = size_t (*)(void const* str, size_t size, std::uint32_t bound) noexcept;
+
+/**
+ * @brief Signature shared by the mismatch kernels: index of the first differing byte of two sequences of size bytes.
+ */
+using mismatch_kernel = size_t (*)(void const* lhs, void const* rhs, size_t size) noexcept;
+
+template <size_t Unit> struct unit_type;
+
+template <> struct unit_type<1>
+{
+    using type = std::uint8_t;
+};
+
+template <> struct unit_type<2>
+{
+    using type = std::uint16_t;
+};
+
+template <> struct unit_type<4>
+{
+    using type = std::uint32_t;
+};
+
+/**
+ * @brief Portable kernel: index of the first zero code unit in [str, str + limit), limit if there is none.
+ */
+template <size_t Unit> size_t terminator_scan_scalar(void const* str, size_t limit) noexcept
+{
+    auto const* units = static_cast<typename unit_type<Unit>::type const*>(str);
+    size_t      index = 0;
+    while (index < limit && units[index] != 0)
+    {
+        ++index;
+    }
+    return index;
+}
+
+/**
+ * @brief Portable kernel: number of leading code units in [str, str + size) whose unsigned value is below bound.
+ */
+template <size_t Unit> size_t leading_below_scalar(void const* str, size_t size, std::uint32_t bound) noexcept
+{
+    auto const* units = static_cast<typename unit_type<Unit>::type const*>(str);
+    size_t      index = 0;
+    while (index < size && units[index] < bound)
+    {
+        ++index;
+    }
+    return index;
+}
+
+/**
+ * @brief Portable kernel: index of the first byte in which [lhs, lhs + size) and [rhs, rhs + size) differ, size if
+ * they are equal.
+ */
+inline size_t first_mismatch_scalar(void const* lhs, void const* rhs, size_t size) noexcept
+{
+    auto const* left  = static_cast<std::uint8_t const*>(lhs);
+    auto const* right = static_cast<std::uint8_t const*>(rhs);
+    size_t      index = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // eight bytes at a time: the lowest set bit of the difference is in the first differing byte
+    for (; index + sizeof(std::uint64_t) <= size; index += sizeof(std::uint64_t))
+    {
+        std::uint64_t left_word  = 0;
+        std::uint64_t right_word = 0;
+        std::memcpy(&left_word, left + index, sizeof(left_word));
+        std::memcpy(&right_word, right + index, sizeof(right_word));
+        if (left_word != right_word)
+        {
+            return index + static_cast<size_t>(__builtin_ctzll(left_word ^ right_word)) / 8;
+        }
+    }
+#endif
+    while (index < size && left[index] == right[index])
+    {
+        ++index;
+    }
+    return index;
+}
+
+#if defined(SIMD_SCAN_X86)
+// clang-format off
+typedef char          v16qi __attribute__((vector_size(16), __may_alias__));
+typedef short         v8hi  __attribute__((vector_size(16), __may_alias__));
+typedef int           v4si  __attribute__((vector_size(16), __may_alias__));
+typedef char          v32qi __attribute__((vector_size(32), __may_alias__));
+typedef short         v16hi __attribute__((vector_size(32), __may_alias__));
+typedef int           v8si  __attribute__((vector_size(32), __may_alias__));
+typedef char          v64qi __attribute__((vector_size(64), __may_alias__));
+typedef short         v32hi __attribute__((vector_size(64), __may_alias__));
+typedef int           v16si __attribute__((vector_size(64), __may_alias__));
+
+// unaligned unsigned vectors for the bounded prefix kernels
+typedef std::uint8_t  vu16qi __attribute__((vector_size(16), __may_alias__, __aligned__(1)));
+typedef std::uint16_t vu8hi  __attribute__((vector_size(16), __may_alias__, __aligned__(1)));
+typedef std::uint32_t vu4si  __attribute__((vector_size(16), __may_alias__, __aligned__(1)));
+typedef std::uint8_t  vu32qi __attribute__((vector_size(32), __may_alias__, __aligned__(1)));
+typedef std::uint16_t vu16hi __attribute__((vector_size(32), __may_alias__, __aligned__(1)));
+typedef std::uint32_t vu8si  __attribute__((vector_size(32), __may_alias__, __aligned__(1)));
+typedef char          v64qi_u __attribute__((vector_size(64), __may_alias__, __aligned__(1)));
+typedef short         v32hi_u __attribute__((vector_size(64), __may_alias__, __aligned__(1)));
+typedef int           v16si_u __attribute__((vector_size(64), __may_alias__, __aligned__(1)));
+// clang-format on
+
+/**
+ * @brief Number of trailing zero bits of a non-zero mask.
+ */
+inline unsigned lowest_bit(std::uint64_t mask) noexcept
+{
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+}
+
+/**
+ * @brief Byte-granular mask of the zero code units in the aligned 16-byte block.
+ */
+template <size_t Unit>
+SIMD_SCAN_NO_SANITIZE __attribute__((target("sse2"))) inline unsigned zero_mask_sse2(char const* block) noexcept
+{
+    if constexpr (Unit == 1)
+    {
+        v16qi const v = *reinterpret_cast<v16qi const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb128(v == v16qi{}));
+    }
+    else if constexpr (Unit == 2)
+    {
+        v8hi const v = *reinterpret_cast<v8hi const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb128(reinterpret_cast<v16qi>(v == v8hi{})));
+    }
+    else
+    {
+        v4si const v = *reinterpret_cast<v4si const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb128(reinterpret_cast<v16qi>(v == v4si{})));
+    }
+}
+
+/**
+ * @brief Byte-granular mask of the zero code units in the aligned 32-byte block.
+ */
+template <size_t Unit>
+SIMD_SCAN_NO_SANITIZE __attribute__((target("avx2"))) inline unsigned zero_mask_avx2(char const* block) noexcept
+{
+    if constexpr (Unit == 1)
+    {
+        v32qi const v = *reinterpret_cast<v32qi const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb256(v == v32qi{}));
+    }
+    else if constexpr (Unit == 2)
+    {
+        v16hi const v = *reinterpret_cast<v16hi const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb256(reinterpret_cast<v32qi>(v == v16hi{})));
+    }
+    else
+    {
+        v8si const v = *reinterpret_cast<v8si const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb256(reinterpret_cast<v32qi>(v == v8si{})));
+    }
+}
+
+/**
+ * @brief Code-unit-granular mask of the zero code units in the aligned 64-byte block.
+ */
+template <size_t Unit>
+SIMD_SCAN_NO_SANITIZE __attribute__((target("avx512f,avx512bw"))) inline std::uint64_t
+zero_mask_avx512(char const* block) noexcept
+{
+    // predicate 0 is _MM_CMPINT_EQ
+    if constexpr (Unit == 1)
+    {
+        v64qi const v = *reinterpret_cast<v64qi const*>(block);
+        return __builtin_ia32_cmpb512_mask(v, v64qi{}, 0, ~std::uint64_t{0});
+    }
+    else if constexpr (Unit == 2)
+    {
+        v32hi const v = *reinterpret_cast<v32hi const*>(block);
+        return __builtin_ia32_cmpw512_mask(v, v32hi{}, 0, ~std::uint32_t{0});
+    }
+    else
+    {
+        v16si const v = *reinterpret_cast<v16si const*>(block);
+        return __builtin_ia32_cmpd512_mask(v, v16si{}, 0, std::uint16_t{0xFFFF});
+    }
+}
+
+/**
+ * @brief Shared block loop. Blocks are aligned, so a load never crosses a page boundary and may only touch bytes of
+ * the page holding valid code units, even before str or past the terminator/limit.
+ *
+ * @tparam Unit size of a code unit in bytes
+ * @tparam Block size of a vector block in bytes
+ * @tparam Granule number of bytes represented by one bit of the mask returned by ZeroMask
+ */
+template <size_t Unit, size_t Block, size_t Granule, typename ZeroMask>
+SIMD_SCAN_NO_SANITIZE inline size_t block_scan(void const* str, size_t limit, ZeroMask zero_mask) noexcept
+{
+    if (limit == 0)
+    {
+        return 0;
+    }
+    auto const  address = reinterpret_cast<std::uintptr_t>(str);
+    auto const  skip    = static_cast<size_t>(address % Block); // bytes of the first block before str
+    char const* block   = reinterpret_cast<char const*>(address - skip);
+
+    std::uint64_t mask = static_cast<std::uint64_t>(zero_mask(block)) >> (skip / Granule);
+    if (mask != 0)
+    {
+        size_t const index = lowest_bit(mask) * Granule / Unit;
+        return index < limit ? index : limit;
+    }
+    for (size_t done = Block - skip; done / Unit < limit; done += Block) // done: bytes from str to the next block
+    {
+        block += Block;
+        mask = zero_mask(block);
+        if (mask != 0)
+        {
+            size_t const index = (done + lowest_bit(mask) * Granule) / Unit;
+            return index < limit ? index : limit;
+        }
+    }
+    return limit;
+}
+
+template <size_t Unit>
+SIMD_SCAN_NO_SANITIZE __attribute__((target("sse2"), flatten)) size_t
+terminator_scan_sse2(void const* str, size_t limit) noexcept
+{
+    return block_scan<Unit, 16, 1>(str, limit, [](char const* block) { return zero_mask_sse2<Unit>(block); });
+}
+
+template <size_t Unit>
+SIMD_SCAN_NO_SANITIZE __attribute__((target("avx2"), flatten)) size_t
+terminator_scan_avx2(void const* str, size_t limit) noexcept
+{
+    return block_scan<Unit, 32, 1>(str, limit, [](char const* block) { return zero_mask_avx2<Unit>(block); });
+}
+
+template <size_t Unit>
+SIMD_SCAN_NO_SANITIZE __attribute__((target("avx512f,avx512bw"), flatten)) size_t
+terminator_scan_avx512(void const* str, size_t limit) noexcept
+{
+    return block_scan<Unit, 64, Unit>(str, limit, [](char const* block) { return zero_mask_avx512<Unit>(block); });
+}
+
+/**
+ * @brief Shared loop of the prefix kernels. Only whole blocks inside [str, str + size) are loaded (unaligned); the
+ * remainder is handled by the scalar kernel.
+ *
+ * @tparam Unit size of a code unit in bytes
+ * @tparam Block size of a vector block in bytes
+ * @tparam Granule number of bytes represented by one bit of the mask returned by AboveMask
+ */
+template <size_t Unit, size_t Block, size_t Granule, typename AboveMask>
+inline size_t block_prefix(void const* str, size_t size, std::uint32_t bound, AboveMask const& above_mask) noexcept
+{
+    constexpr size_t units_per_block = Block / Unit;
+    auto const*      bytes           = static_cast<char const*>(str);
+    size_t           index           = 0;
+    for (; index + units_per_block <= size; index += units_per_block)
+    {
+        std::uint64_t const mask = above_mask(bytes + index * Unit);
+        if (mask != 0)
+        {
+            return index + lowest_bit(mask) * Granule / Unit;
+        }
+    }
+    return index + leading_below_scalar<Unit>(bytes + index * Unit, size - index, bound);
+}
+
+/**
+ * @brief Byte-granular mask of the code units not below bound in the unaligned 16-byte block.
+ */
+template <size_t Unit>
+__attribute__((target("sse2"))) inline unsigned above_mask_sse2(char const* block, std::uint32_t bound) noexcept
+{
+    if constexpr (Unit == 1)
+    {
+        vu16qi const v = *reinterpret_cast<vu16qi const*>(block);
+        return static_cast<unsigned>(
+            __builtin_ia32_pmovmskb128(reinterpret_cast<v16qi>(v >= vu16qi{} + static_cast<std::uint8_t>(bound))));
+    }
+    else if constexpr (Unit == 2)
+    {
+        vu8hi const v = *reinterpret_cast<vu8hi const*>(block);
+        return static_cast<unsigned>(
+            __builtin_ia32_pmovmskb128(reinterpret_cast<v16qi>(v >= vu8hi{} + static_cast<std::uint16_t>(bound))));
+    }
+    else
+    {
+        vu4si const v = *reinterpret_cast<vu4si const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb128(reinterpret_cast<v16qi>(v >= vu4si{} + bound)));
+    }
+}
+
+/**
+ * @brief Byte-granular mask of the code units not below bound in the unaligned 32-byte block.
+ */
+template <size_t Unit>
+__attribute__((target("avx2"))) inline unsigned above_mask_avx2(char const* block, std::uint32_t bound) noexcept
+{
+    if constexpr (Unit == 1)
+    {
+        vu32qi const v = *reinterpret_cast<vu32qi const*>(block);
+        return static_cast<unsigned>(
+            __builtin_ia32_pmovmskb256(reinterpret_cast<v32qi>(v >= vu32qi{} + static_cast<std::uint8_t>(bound))));
+    }
+    else if constexpr (Unit == 2)
+    {
+        vu16hi const v = *reinterpret_cast<vu16hi const*>(block);
+        return static_cast<unsigned>(
+            __builtin_ia32_pmovmskb256(reinterpret_cast<v32qi>(v >= vu16hi{} + static_cast<std::uint16_t>(bound))));
+    }
+    else
+    {
+        vu8si const v = *reinterpret_cast<vu8si const*>(block);
+        return static_cast<unsigned>(__builtin_ia32_pmovmskb256(reinterpret_cast<v32qi>(v >= vu8si{} + bound)));
+    }
+}
+
+/**
+ * @brief Code-unit-granular mask of the code units not below bound in the unaligned 64-byte block.
+ */
+template <size_t Unit>
+__attribute__((target("avx512f,avx512bw"))) inline std::uint64_t
+above_mask_avx512(char const* block, std::uint32_t bound) noexcept
+{
+    // predicate 5 is _MM_CMPINT_NLT, i.e. unsigned greater or equal
+    if constexpr (Unit == 1)
+    {
+        v64qi const v = *reinterpret_cast<v64qi_u const*>(block);
+        return __builtin_ia32_ucmpb512_mask(v, v64qi{} + static_cast<char>(bound), 5, ~std::uint64_t{0});
+    }
+    else if constexpr (Unit == 2)
+    {
+        v32hi const v = *reinterpret_cast<v32hi_u const*>(block);
+        return static_cast<std::uint64_t>(
+            __builtin_ia32_ucmpw512_mask(v, v32hi{} + static_cast<short>(bound), 5, ~std::uint32_t{0}));
+    }
+    else
+    {
+        v16si const v = *reinterpret_cast<v16si_u const*>(block);
+        return static_cast<std::uint64_t>(
+            __builtin_ia32_ucmpd512_mask(v, v16si{} + static_cast<int>(bound), 5, std::uint16_t{0xFFFF}));
+    }
+}
+
+template <size_t Unit>
+__attribute__((target("sse2"), flatten)) size_t
+leading_below_sse2(void const* str, size_t size, std::uint32_t bound) noexcept
+{
+    return block_prefix<Unit, 16, 1>(
+        str, size, bound, [bound](char const* block) { return above_mask_sse2<Unit>(block, bound); });
+}
+
+template <size_t Unit>
+__attribute__((target("avx2"), flatten)) size_t
+leading_below_avx2(void const* str, size_t size, std::uint32_t bound) noexcept
+{
+    return block_prefix<Unit, 32, 1>(
+        str, size, bound, [bound](char const* block) { return above_mask_avx2<Unit>(block, bound); });
+}
+
+template <size_t Unit>
+__attribute__((target("avx512f,avx512bw"), flatten)) size_t
+leading_below_avx512(void const* str, size_t size, std::uint32_t bound) noexcept
+{
+    return block_prefix<Unit, 64, Unit>(
+        str, size, bound, [bound](char const* block) { return above_mask_avx512<Unit>(block, bound); });
+}
+
+/**
+ * @brief Shared loop of the mismatch kernels: whole blocks are compared with unaligned loads, the remainder by the
+ * scalar kernel.
+ *
+ * @tparam Block size of a vector block in bytes
+ */
+template <size_t Block, typename DiffMask>
+inline size_t block_mismatch(void const* lhs, void const* rhs, size_t size, DiffMask const& diff_mask) noexcept
+{
+    auto const* left  = static_cast<char const*>(lhs);
+    auto const* right = static_cast<char const*>(rhs);
+    size_t      index = 0;
+    for (; index + Block <= size; index += Block)
+    {
+        std::uint64_t const mask = diff_mask(left + index, right + index);
+        if (mask != 0)
+        {
+            return index + lowest_bit(mask);
+        }
+    }
+    return index + first_mismatch_scalar(left + index, right + index, size - index);
+}
+
+/**
+ * @brief Byte mask of the differing bytes of the unaligned 16-byte blocks.
+ */
+__attribute__((target("sse2"))) inline unsigned diff_mask_sse2(char const* left, char const* right) noexcept
+{
+    vu16qi const l = *reinterpret_cast<vu16qi const*>(left);
+    vu16qi const r = *reinterpret_cast<vu16qi const*>(right);
+    return static_cast<unsigned>(__builtin_ia32_pmovmskb128(reinterpret_cast<v16qi>(l != r)));
+}
+
+/**
+ * @brief Byte mask of the differing bytes of the unaligned 32-byte blocks.
+ */
+__attribute__((target("avx2"))) inline unsigned diff_mask_avx2(char const* left, char const* right) noexcept
+{
+    vu32qi const l = *reinterpret_cast<vu32qi const*>(left);
+    vu32qi const r = *reinterpret_cast<vu32qi const*>(right);
+    return static_cast<unsigned>(__builtin_ia32_pmovmskb256(reinterpret_cast<v32qi>(l != r)));
+}
+
+/**
+ * @brief Byte mask of the differing bytes of the unaligned 64-byte blocks.
+ */
+__attribute__((target("avx512f,avx512bw"))) inline std::uint64_t diff_mask_avx512(char const* left,
+                                                                                 char const* right) noexcept
+{
+    // predicate 4 is _MM_CMPINT_NE
+    v64qi const l = *reinterpret_cast<v64qi_u const*>(left);
+    v64qi const r = *reinterpret_cast<v64qi_u const*>(right);
+    return __builtin_ia32_cmpb512_mask(l, r, 4, ~std::uint64_t{0});
+}
+
+__attribute__((target("sse2"), flatten)) inline size_t
+first_mismatch_sse2(void const* lhs, void const* rhs, size_t size) noexcept
+{
+    return block_mismatch<16>(lhs, rhs, size, diff_mask_sse2);
+}
+
+__attribute__((target("avx2"), flatten)) inline size_t
+first_mismatch_avx2(void const* lhs, void const* rhs, size_t size) noexcept
+{
+    return block_mismatch<32>(lhs, rhs, size, diff_mask_avx2);
+}
+
+__attribute__((target("avx512f,avx512bw"), flatten)) inline size_t
+first_mismatch_avx512(void const* lhs, void const* rhs, size_t size) noexcept
+{
+    return block_mismatch<64>(lhs, rhs, size, diff_mask_avx512);
+}
+#endif
+
+/**
+ * @brief Mismatch kernel for the given instruction set, falling back to the scalar one where none is compiled in.
+ */
+inline mismatch_kernel first_mismatch_kernel(isa kernel) noexcept
+{
+#if defined(SIMD_SCAN_X86)
+    switch (kernel)
+    {
+        case isa::avx512:
+            return &first_mismatch_avx512;
+        case isa::avx2:
+            return &first_mismatch_avx2;
+        case isa::sse2:
+            return &first_mismatch_sse2;
+        case isa::scalar:
+            break;
+    }
+#else
+    static_cast<void>(kernel);
+#endif
+    return &first_mismatch_scalar;
+}
+
+/**
+ * @brief Whether bound exceeds every value a code unit of Unit bytes can have. The vector kernels compare in the width
+ * of the unit and cannot represent such a bound; every unit is below it.
+ */
+template <size_t Unit> constexpr bool above_all_units(std::uint32_t bound) noexcept
+{
+    if constexpr (Unit < sizeof(std::uint32_t))
+    {
+        return bound >> (8 * Unit) != 0;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+/**
+ * @brief Prefix kernel for the given instruction set, falling back to the scalar one where none is compiled in.
+ */
+template <size_t Unit> prefix_kernel leading_below_kernel(isa kernel) noexcept
+{
+#if defined(SIMD_SCAN_X86)
+    switch (kernel)
+    {
+        case isa::avx512:
+            return &leading_below_avx512<Unit>;
+        case isa::avx2:
+            return &leading_below_avx2<Unit>;
+        case isa::sse2:
+            return &leading_below_sse2<Unit>;
+        case isa::scalar:
+            break;
+    }
+#else
+    static_cast<void>(kernel);
+#endif
+    return &leading_below_scalar<Unit>;
+}
+
+/**
+ * @brief Kernel for the given instruction set, falling back to the next lower one that is compiled in.
+ */
+template <size_t Unit> scan_kernel terminator_scan_kernel(isa kernel) noexcept
+{
+#if defined(SIMD_SCAN_X86)
+    switch (kernel)
+    {
+        case isa::avx512:
+            return &terminator_scan_avx512<Unit>;
+        case isa::avx2:
+            return &terminator_scan_avx2<Unit>;
+        case isa::sse2:
+            return &terminator_scan_sse2<Unit>;
+        case isa::scalar:
+            break;
+    }
+#else
+    static_cast<void>(kernel);
+#endif
+    return &terminator_scan_scalar<Unit>;
+}
+} // namespace detail
+
+/**
+ * @brief Index of the first null code unit in [str, str + limit), or limit if there is none, using the kernel for
+ * the requested instruction set. The caller must make sure the CPU supports it (see detected_isa()).
+ *
+ * @tparam CharT character type; code units of 1, 2 and 4 bytes are supported
+ * @param str start of the sequence
+ * @param limit maximal number of code units to examine
+ * @param kernel instruction set of the kernel to use
+ * @return size_t number of code units before the terminator
+ */
+template <typename CharT> size_t terminator_scan(CharT const* str, size_t limit, isa kernel) noexcept
+{
+    static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4, "unsupported code unit size");
+    return detail::terminator_scan_kernel<sizeof(CharT)>(kernel)(str, limit);
+}
+
+/**
+ * @brief Index of the first null code unit in [str, str + limit), or limit if there is none, using the best kernel
+ * the executing CPU supports. The kernel is selected once per code unit size; unbounded scans of single-byte code
+ * units use the C library's strlen.
+ *
+ * @tparam CharT character type; code units of 1, 2 and 4 bytes are supported
+ * @param str start of the sequence
+ * @param limit maximal number of code units to examine; unbounded by default
+ * @return size_t number of code units before the terminator
+ */
+template <typename CharT> size_t terminator_scan(CharT const* str, size_t limit = ~size_t{0}) noexcept
+{
+    static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4, "unsupported code unit size");
+    if constexpr (sizeof(CharT) == 1)
+    {
+        // the C library's strlen is already vectorised at least as well
+        if (limit == ~size_t{0})
+        {
+            return std::char_traits<char>::length(reinterpret_cast<char const*>(str));
+        }
+    }
+    static detail::scan_kernel const kernel = detail::terminator_scan_kernel<sizeof(CharT)>(active_isa());
+    return kernel(str, limit);
+}
+
+/**
+ * @brief Number of leading code units in [str, str + size) whose unsigned value is below bound, using the kernel for
+ * the requested instruction set. The caller must make sure the CPU supports it (see detected_isa()).
+ *
+ * @tparam CharT character type; code units of 1, 2 and 4 bytes are supported
+ * @param str start of the sequence
+ * @param size number of code units in the sequence; nothing past it is read
+ * @param bound exclusive upper bound, e.g. 0x80 to find the ASCII prefix
+ * @param kernel instruction set of the kernel to use
+ * @return size_t length of the prefix
+ */
+template <typename CharT>
+size_t leading_below(CharT const* str, size_t size, std::uint32_t bound, isa kernel) noexcept
+{
+    static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4, "unsupported code unit size");
+    if (detail::above_all_units<sizeof(CharT)>(bound))
+    {
+        return size;
+    }
+    return detail::leading_below_kernel<sizeof(CharT)>(kernel)(str, size, bound);
+}
+
+/**
+ * @brief Number of leading code units in [str, str + size) whose unsigned value is below bound, using the best kernel
+ * the executing CPU supports. The kernel is selected once per code unit size.
+ *
+ * @tparam CharT character type; code units of 1, 2 and 4 bytes are supported
+ * @param str start of the sequence
+ * @param size number of code units in the sequence; nothing past it is read
+ * @param bound exclusive upper bound, e.g. 0x80 to find the ASCII prefix
+ * @return size_t length of the prefix
+ */
+template <typename CharT> size_t leading_below(CharT const* str, size_t size, std::uint32_t bound) noexcept
+{
+    static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4, "unsupported code unit size");
+    if (detail::above_all_units<sizeof(CharT)>(bound))
+    {
+        return size;
+    }
+    static detail::prefix_kernel const kernel = detail::leading_below_kernel<sizeof(CharT)>(active_isa());
+    return kernel(str, size, bound);
+}
+
+/**
+ * @brief Index of the first code unit in which [lhs, lhs + size) and [rhs, rhs + size) differ, or size if they are
+ * equal, using the kernel for the requested instruction set. The caller must make sure the CPU supports it.
+ *
+ * @tparam CharT character type
+ * @param lhs start of the first sequence
+ * @param rhs start of the second sequence
+ * @param size number of code units to compare; nothing past it is read
+ * @param kernel instruction set of the kernel to use
+ * @return size_t index of the first differing code unit
+ */
+template <typename CharT>
+size_t first_mismatch(CharT const* lhs, CharT const* rhs, size_t size, isa kernel) noexcept
+{
+    return detail::first_mismatch_kernel(kernel)(lhs, rhs, size * sizeof(CharT)) / sizeof(CharT);
+}
+
+/**
+ * @brief Index of the first code unit in which [lhs, lhs + size) and [rhs, rhs + size) differ, or size if they are
+ * equal, using the best kernel the executing CPU supports (selected once).
+ *
+ * @tparam CharT character type
+ * @param lhs start of the first sequence
+ * @param rhs start of the second sequence
+ * @param size number of code units to compare; nothing past it is read
+ * @return size_t index of the first differing code unit
+ */
+template <typename CharT> size_t first_mismatch(CharT const* lhs, CharT const* rhs, size_t size) noexcept
+{
+    static detail::mismatch_kernel const kernel = detail::first_mismatch_kernel(active_isa());
+    return kernel(lhs, rhs, size * sizeof(CharT)) / sizeof(CharT);
+}
+
+} // namespace util::simd
+
+#endif // SIMD_SCAN_H_INCLUDED
@@ -0,0 +1,147 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/string_compare.h
+ * Description: Transparent three-way comparison and ordering of string-likes and characters.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef STRING_COMPARE_H_INCLUDED
+#define STRING_COMPARE_H_INCLUDED
+
+#include "simd_scan.h"
+#include "traits.h"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace util
+{
+
+/**
+ * @brief T1 and T2 can be compared as strings: two compatible string-likes, or a string-like and a single character of
+ * its character type, in either order, as modelled by has_std_string_compatible_char.
+ */
+template <typename T1, typename T2>
+concept comparable_string_or_char = has_std_string_compatible_char_v<T1, T2> ||
+                                    has_std_string_compatible_char_v<T2, T1>;
+
+namespace detail
+{
+/**
+ * @brief View on a string-like, or on a single character as a string of length one.
+ */
+template <typename T> constexpr auto string_or_char_view(T const& str_or_char)
+{
+    if constexpr (is_char_v<T>)
+    {
+        return std::basic_string_view<T>(&str_or_char, 1);
+    }
+    else
+    {
+        return as_string_view(str_or_char);
+    }
+}
+
+/**
+ * @brief Three-way lexicographic comparison of two views by code unit, ordered like std::char_traits, with the
+ * shorter one ordered first if it is a prefix of the other. Wide code units are compared with the vectorised mismatch
+ * kernel (std::char_traits compares them one at a time); single bytes with char_traits::compare, i.e. memcmp.
+ */
+template <typename CharT>
+constexpr std::strong_ordering compare_views(std::basic_string_view<CharT> lhs, std::basic_string_view<CharT> rhs)
+{
+    using traits_type    = std::char_traits<CharT>;
+    size_t const common  = std::min(lhs.size(), rhs.size());
+    int          ordered = 0;
+    if constexpr (sizeof(CharT) > 1)
+    {
+        if consteval
+        {
+            ordered = traits_type::compare(lhs.data(), rhs.data(), common);
+        }
+        else
+        {
+            size_t const index = simd::first_mismatch(lhs.data(), rhs.data(), common);
+            if (index < common)
+            {
+                ordered = traits_type::lt(lhs[index], rhs[index]) ? -1 : 1;
+            }
+        }
+    }
+    else
+    {
+        ordered = traits_type::compare(lhs.data(), rhs.data(), common);
+    }
+    if (ordered != 0)
+    {
+        return ordered < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    return lhs.size() <=> rhs.size();
+}
+} // namespace detail
+
+/**
+ * @brief Transparent three-way comparison of string-likes and characters.
+ *
+ * @code{.cpp}
+ * util::string_compare{}(std::u16string(u"abc"), u"abd"); // std::strong_ordering::less
+ * util::string_compare{}("b", 'a');                       // std::strong_ordering::greater
+ * @endcode
+ */
+struct string_compare
+{
+    using is_transparent = void;
+
+    template <typename T1, typename T2>
+    requires comparable_string_or_char<T1, T2>
+    constexpr std::strong_ordering operator()(T1 const& lhs, T2 const& rhs) const noexcept
+    {
+        return detail::compare_views(detail::string_or_char_view(lhs), detail::string_or_char_view(rhs));
+    }
+};
+
+/**
+ * @brief Transparent less-than of string-likes and characters, so that ordered containers keyed on
+ * std::basic_string can be searched with literals, pointers and views without building a temporary key:
+ *
+ * @code{.cpp}
+ * std::map<std::string, int, util::string_less> ranks;
+ * auto found = ranks.find("key"); // no std::string constructed
+ * @endcode
+ */
+struct string_less
+{
+    using is_transparent = void;
+
+    template <typename T1, typename T2>
+    requires comparable_string_or_char<T1, T2>
+    constexpr bool operator()(T1 const& lhs, T2 const& rhs) const noexcept
+    {
+        return string_compare{}(lhs, rhs) < 0;
+    }
+};
+
+} // namespace util
+
+#endif // STRING_COMPARE_H_INCLUDED
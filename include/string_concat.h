@@ -0,0 +1,321 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/string_concat.h
+ * Description: Single-allocation concatenation of any mix of compatible strings and characters.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef STRING_CONCAT_H_INCLUDED
+#define STRING_CONCAT_H_INCLUDED
+
+#include "traits.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+/**
+ * @brief T can be concatenated to a std::basic_string of CharT: it is a compatible string or a CharT character, as
+ * modelled by has_std_string_compatible_char.
+ */
+template <typename T, typename CharT>
+concept concat_operand_of = has_std_string_compatible_char_v<std::basic_string<CharT>, std::remove_cvref_t<T>>;
+
+/**
+ * @brief Character type of a string-like or the character type itself.
+ */
+template <typename T>
+using string_or_char_type_t = std::conditional_t<is_char_v<std::remove_cvref_t<T>>,
+                                                 std::remove_cvref_t<T>,
+                                                 string_char_t<std::remove_cvref_t<T>>>;
+
+namespace detail
+{
+/**
+ * @brief Copy one piece of the given, already computed size and return the position behind it.
+ */
+template <typename CharT, typename T> constexpr CharT* copy_piece(CharT* out, T const& piece, size_t size)
+{
+    if constexpr (is_char_v<T>)
+    {
+        *out = piece;
+    }
+    else if constexpr (string_kind_v<T> == string_kind::std_string ||
+                       string_kind_v<T> == string_kind::std_string_view ||
+                       string_kind_v<T> == string_kind::fixed_string)
+    {
+        std::char_traits<CharT>::copy(out, piece.data(), size);
+    }
+    else
+    {
+        std::char_traits<CharT>::copy(out, piece, size);
+    }
+    return out + size;
+}
+
+/**
+ * @brief First character of a piece, or nullptr for a single character.
+ */
+template <typename CharT, typename T> constexpr CharT const* piece_data(T const& piece)
+{
+    if constexpr (is_char_v<T>)
+    {
+        return nullptr;
+    }
+    else if constexpr (string_kind_v<T> == string_kind::std_string ||
+                       string_kind_v<T> == string_kind::std_string_view ||
+                       string_kind_v<T> == string_kind::fixed_string)
+    {
+        return piece.data();
+    }
+    else
+    {
+        return piece;
+    }
+}
+
+/**
+ * @brief Whether any piece points into the characters of out, which growing out may free before they are copied. During
+ * constant evaluation, where pointers into different objects cannot be ordered, any piece is assumed to.
+ */
+template <typename CharT, typename Traits, typename Alloc, typename... Ts>
+constexpr bool aliases_any(std::basic_string<CharT, Traits, Alloc> const& out, Ts const&... pieces)
+{
+    if constexpr (sizeof...(Ts) == 0)
+    {
+        return false;
+    }
+    else if consteval
+    {
+        return true;
+    }
+    else
+    {
+        CharT const* const                  first = out.data();
+        CharT const* const                  last  = first + out.size();
+        std::less_equal<CharT const*> const not_after;
+        return ((not_after(first, piece_data<CharT>(pieces)) && not_after(piece_data<CharT>(pieces), last)) || ...);
+    }
+}
+
+/**
+ * @brief Grow out by total characters and copy the pieces of the given sizes there, none of which may alias out.
+ */
+template <typename CharT, typename Traits, typename Alloc, typename... Ts>
+constexpr void write_pieces(std::basic_string<CharT, Traits, Alloc>& out,
+                            size_t const*                            sizes,
+                            size_t                                   total,
+                            Ts const&... pieces)
+{
+    size_t const old_size = out.size();
+
+#if defined(__cpp_lib_string_resize_and_overwrite)
+    // return the computed size rather than the callback's size argument: some libstdc++ versions pass the capacity
+    out.resize_and_overwrite(old_size + total, [&](CharT* buffer, size_t /* capacity */) {
+        [[maybe_unused]] CharT* pos = buffer + old_size;
+        size_t index = 0;
+        ((pos = copy_piece(pos, pieces, sizes[index++])), ...);
+        return old_size + total;
+    });
+#else
+    out.resize(old_size + total);
+    [[maybe_unused]] CharT* pos = out.data() + old_size;
+    size_t index = 0;
+    ((pos = copy_piece(pos, pieces, sizes[index++])), ...);
+#endif
+}
+
+/**
+ * @brief Append all pieces to out, growing it at most once. Each piece's size is computed exactly once. Pieces may
+ * refer to out itself, as in append_to(str, str, str.c_str()).
+ */
+template <typename CharT, typename Traits, typename Alloc, typename... Ts>
+constexpr void append_pieces(std::basic_string<CharT, Traits, Alloc>& out, Ts const&... pieces)
+{
+    size_t const sizes[] = {string_or_char_size(pieces)..., 0UL};
+    size_t       total   = 0UL;
+    for (size_t size : sizes)
+    {
+        total += size;
+    }
+
+    if (aliases_any(out, pieces...))
+    {
+        // growing out in place would free the characters still to be copied: build the result beside it
+        std::basic_string<CharT, Traits, Alloc> result(out.get_allocator());
+        result.reserve(out.size() + total);
+        result.append(out);
+        write_pieces(result, sizes, total, pieces...);
+        out = std::move(result);
+    }
+    else
+    {
+        write_pieces(out, sizes, total, pieces...);
+    }
+}
+
+/**
+ * @brief Storage of an operand in a lazy concatenation: characters by value, everything else by reference.
+ */
+template <typename T> using concat_storage_t = std::conditional_t<is_char_v<T>, T, T const&>;
+} // namespace detail
+
+/**
+ * @brief Append any mix of compatible strings and characters to out with at most one reallocation and without
+ * temporaries.
+ *
+ * @param out string to append to
+ * @param pieces std::basic_string, std::basic_string_view, character pointers, arrays or single characters, all of
+ * the character type of out
+ */
+template <typename CharT, typename Traits, typename Alloc, typename... Ts>
+requires(concat_operand_of<Ts, CharT> && ...)
+constexpr void append_to(std::basic_string<CharT, Traits, Alloc>& out, Ts const&... pieces)
+{
+    detail::append_pieces(out, pieces...);
+}
+
+/**
+ * @brief Concatenate any mix of compatible strings and characters into a new string allocated exactly once.
+ *
+ * @code{.cpp}
+ * std::string key = util::concat(prefix, ':', std::string_view{id}, "/", suffix);
+ * @endcode
+ *
+ * @param first the first piece; determines the character type of the result
+ * @param rest further pieces of the same character type
+ * @return std::basic_string of the common character type
+ */
+template <typename First, typename... Rest>
+requires(is_string_v<First> || is_char_v<First>) && (concat_operand_of<Rest, string_or_char_type_t<First>> && ...)
+constexpr std::basic_string<string_or_char_type_t<First>> concat(First const& first, Rest const&... rest)
+{
+    std::basic_string<string_or_char_type_t<First>> result;
+    detail::append_pieces(result, first, rest...);
+    return result;
+}
+
+/**
+ * @brief Lazy concatenation built with operator+. Nothing is computed until the expression is converted to a string
+ * or appended to one; then the size is computed up front and the result is allocated exactly once.
+ * Operands other than characters are held by reference, so the expression must be materialised within the full
+ * expression that creates it (do not store it in an auto variable when it refers to temporaries).
+ *
+ * @tparam CharT the common character type
+ * @tparam Ts the operand types
+ */
+template <typename CharT, typename... Ts> class concat_expr
+{
+    using storage_type = std::tuple<detail::concat_storage_t<Ts>...>;
+
+    storage_type pieces_;
+
+    template <typename, typename...> friend class concat_expr;
+
+    struct from_storage_t
+    {
+    };
+
+    constexpr concat_expr(from_storage_t, storage_type pieces)
+        : pieces_(std::move(pieces))
+    {
+    }
+
+    template <typename T> constexpr concat_expr<CharT, Ts..., T> extend(T const& rhs) const
+    {
+        using result_type = concat_expr<CharT, Ts..., T>;
+        return result_type(typename result_type::from_storage_t{},
+                           std::tuple_cat(pieces_, std::tuple<detail::concat_storage_t<T>>(rhs)));
+    }
+
+  public:
+    using char_type = CharT;
+
+    constexpr explicit concat_expr(Ts const&... pieces)
+        : pieces_(pieces...)
+    {
+    }
+
+    /**
+     * @brief Number of characters of the concatenation.
+     */
+    [[nodiscard]] constexpr size_t size() const
+    {
+        return std::apply([](auto const&... piece) { return (size_t{0} + ... + string_or_char_size(piece)); }, pieces_);
+    }
+
+    /**
+     * @brief Append the concatenation to out.
+     */
+    template <typename Traits, typename Alloc>
+    constexpr void append_to(std::basic_string<CharT, Traits, Alloc>& out) const
+    {
+        std::apply([&out](auto const&... piece) { detail::append_pieces(out, piece...); }, pieces_);
+    }
+
+    /**
+     * @brief Materialise the concatenation.
+     */
+    [[nodiscard]] constexpr std::basic_string<CharT> str() const
+    {
+        std::basic_string<CharT> result;
+        append_to(result);
+        return result;
+    }
+
+    template <typename Traits, typename Alloc> constexpr operator std::basic_string<CharT, Traits, Alloc>() const
+    {
+        std::basic_string<CharT, Traits, Alloc> result;
+        append_to(result);
+        return result;
+    }
+
+    template <typename T>
+    requires concat_operand_of<T, CharT>
+    friend constexpr concat_expr<CharT, Ts..., T> operator+(concat_expr const& lhs, T const& rhs)
+    {
+        return lhs.extend(rhs);
+    }
+};
+
+/**
+ * @brief Start a lazy concatenation; extend it with operator+.
+ *
+ * @code{.cpp}
+ * std::string key = util::lazy_concat(prefix) + ':' + id + "/" + suffix; // one allocation
+ * @endcode
+ */
+template <typename First, typename... Rest>
+requires(is_string_v<First> || is_char_v<First>) && (concat_operand_of<Rest, string_or_char_type_t<First>> && ...)
+constexpr concat_expr<string_or_char_type_t<First>, First, Rest...> lazy_concat(First const& first, Rest const&... rest)
+{
+    return concat_expr<string_or_char_type_t<First>, First, Rest...>(first, rest...);
+}
+
+} // namespace util
+
+#endif // STRING_CONCAT_H_INCLUDED
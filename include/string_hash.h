@@ -0,0 +1,96 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/string_hash.h
+ * Description: Transparent hash and equality functors for heterogeneous lookup of string-likes.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef STRING_HASH_H_INCLUDED
+#define STRING_HASH_H_INCLUDED
+
+#include "traits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief 64-bit FNV-1a over the code units of a string.
+ */
+template <typename CharT> constexpr uint64_t fnv1a(std::basic_string_view<CharT> str) noexcept
+{
+    uint64_t hash = 14'695'981'039'346'656'037ULL;
+    for (CharT const unit : str)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<std::make_unsigned_t<CharT>>(unit));
+        hash *= 1'099'511'628'211ULL;
+    }
+    return hash;
+}
+} // namespace detail
+
+/**
+ * @brief Transparent hash of any string-like. All string-likes with the same characters hash alike, so that
+ * unordered containers keyed on std::basic_string can be searched with character pointers, arrays and string views
+ * without building a temporary key:
+ *
+ * @code{.cpp}
+ * std::unordered_map<std::string, int, util::string_hash, util::string_equal> counts;
+ * auto found = counts.find("key"); // no std::string constructed
+ * @endcode
+ */
+struct string_hash
+{
+    using is_transparent = void;
+
+    template <typename T>
+    requires is_string_v<T>
+    size_t operator()(T const& str) const noexcept
+    {
+        return std::hash<std::basic_string_view<string_char_t<T>>>{}(as_string_view(str));
+    }
+};
+
+/**
+ * @brief Transparent equality of any two compatible string-likes (see is_compatible_string), comparing characters.
+ */
+struct string_equal
+{
+    using is_transparent = void;
+
+    template <typename T1, typename T2>
+    requires is_compatible_string_v<T1, T2>
+    constexpr bool operator()(T1 const& lhs, T2 const& rhs) const noexcept
+    {
+        return as_string_view(lhs) == as_string_view(rhs);
+    }
+};
+
+} // namespace util
+
+#endif // STRING_HASH_H_INCLUDED
@@ -0,0 +1,154 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/string_sso.h
+ * Description: Small-string-optimisation capacity of std::basic_string types and inline-fit checks for string-likes.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef STRING_SSO_H_INCLUDED
+#define STRING_SSO_H_INCLUDED
+
+#include "traits.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace util
+{
+
+template <typename T>
+concept is_std_string_c = is_std_string_v<T>;
+
+namespace detail
+{
+/**
+ * @brief Inline capacity of a std::basic_string as laid out by the standard library in use, where that layout is known.
+ * Unknown layouts are probed at startup instead.
+ */
+template <typename String> struct sso_layout
+{
+    static constexpr bool   is_known = false;
+    static constexpr size_t capacity = 0;
+};
+
+#if defined(__GLIBCXX__)
+/**
+ * @brief libstdc++: a 16-byte local buffer, whatever the allocator, holding 15 bytes of characters and a terminator;
+ * the copy-on-write strings of the old ABI have no inline buffer.
+ */
+template <typename CharT, typename Traits, typename Alloc> struct sso_layout<std::basic_string<CharT, Traits, Alloc>>
+{
+    static constexpr bool   is_known = true;
+    #if _GLIBCXX_USE_CXX11_ABI
+    static constexpr size_t capacity = 15 / sizeof(CharT);
+    #else
+    static constexpr size_t capacity = 0;
+    #endif
+};
+#elif defined(_LIBCPP_VERSION)
+/**
+ * @brief libc++: the short form reuses the capacity, size and pointer of the long form but for one byte, and needs room
+ * for at least two characters and the terminator. Other allocators may have other pointer types, so they are probed.
+ * During constant evaluation libc++ never stores strings inline; the value describes run time.
+ */
+template <typename CharT, typename Traits> struct sso_layout<std::basic_string<CharT, Traits, std::allocator<CharT>>>
+{
+    static constexpr size_t long_size = 2 * sizeof(size_t) + sizeof(CharT*);
+    static constexpr size_t min_cap   = (long_size - 1) / sizeof(CharT) > 2 ? (long_size - 1) / sizeof(CharT) : 2;
+
+    static constexpr bool   is_known = true;
+    static constexpr size_t capacity = min_cap - 1;
+};
+#elif defined(_MSVC_STL_VERSION)
+/**
+ * @brief Microsoft STL: a 16-byte buffer, whatever the allocator, holding at least one character and the terminator.
+ */
+template <typename CharT, typename Traits, typename Alloc> struct sso_layout<std::basic_string<CharT, Traits, Alloc>>
+{
+    static constexpr size_t buffer_size = 16 / sizeof(CharT) < 1 ? 1 : 16 / sizeof(CharT);
+
+    static constexpr bool   is_known = true;
+    static constexpr size_t capacity = buffer_size - 1;
+};
+#endif
+} // namespace detail
+
+/**
+ * @brief Trait to identify std::basic_string types, cv-qualified or not, whose inline capacity is known at compile
+ * time from the layout of the standard library.
+ */
+template <typename String>
+requires is_std_string_c<std::remove_cv_t<String>>
+struct has_constant_sso_capacity : std::bool_constant<detail::sso_layout<std::remove_cv_t<String>>::is_known>
+{
+};
+
+template <typename String> using has_constant_sso_capacity_t = typename has_constant_sso_capacity<String>::type;
+
+template <typename String>
+inline constexpr bool has_constant_sso_capacity_v = has_constant_sso_capacity<String>::value;
+
+/**
+ * @brief Number of characters a std::basic_string, cv-qualified or not, holds without allocating (small-string
+ * optimisation), 0 if it always allocates. A constant expression where has_constant_sso_capacity_v holds; otherwise
+ * the capacity of an empty string, probed once during static initialisation, and so not to be read from the
+ * initialisers of other static objects.
+ *
+ * @code{.cpp}
+ * static_assert(util::sso_capacity_v<std::string> >= 15); // libstdc++ and MSVC: 15, libc++: 22
+ * @endcode
+ */
+template <typename String>
+requires is_std_string_c<std::remove_cv_t<String>>
+inline size_t const sso_capacity_v = std::remove_cv_t<String>().capacity();
+
+template <typename String>
+requires(is_std_string_c<std::remove_cv_t<String>> && detail::sso_layout<std::remove_cv_t<String>>::is_known)
+inline constexpr size_t sso_capacity_v<String> = detail::sso_layout<std::remove_cv_t<String>>::capacity;
+
+/**
+ * @brief Whether a string-like would be stored inline, without a heap allocation, when converted to String; by default
+ * the std::basic_string of its character type. String, cv-qualified or not, must have the character type of the
+ * string-like.
+ *
+ * @code{.cpp}
+ * std::string_view key = "order:42";
+ * if (util::fits_inline(key))
+ * {
+ *     std::string copy{key}; // no allocation
+ * }
+ * @endcode
+ */
+template <typename String = void, typename T>
+requires is_string_v<T> && (std::is_void_v<String> || (is_std_string_c<std::remove_cv_t<String>> &&
+                                                         is_compatible_string_v<std::remove_cv_t<String>, T>))
+constexpr bool fits_inline(T const& str)
+{
+    using target_type =
+        std::conditional_t<std::is_void_v<String>, std::basic_string<string_char_t<T>>, std::remove_cv_t<String>>;
+    return as_string_view(str).size() <= sso_capacity_v<target_type>;
+}
+
+} // namespace util
+
+#endif // STRING_SSO_H_INCLUDED
@@ -0,0 +1,277 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/string_switch.h
+ * Description: Dispatch of run-time strings over a fixed set of keys with a minimal perfect hash built at compile time.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef STRING_SWITCH_H_INCLUDED
+#define STRING_SWITCH_H_INCLUDED
+
+#include "fixed_string.h"
+#include "string_hash.h"
+#include "traits.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Re-hash of a string hash with a seed: the splitmix64 finaliser, so that every seed gives an independent hash.
+ */
+constexpr uint64_t reseed(uint64_t hash, uint64_t seed) noexcept
+{
+    uint64_t mixed = hash ^ (seed * 0x9e37'79b9'7f4a'7c15ULL);
+    mixed          = (mixed ^ (mixed >> 30)) * 0xbf58'476d'1ce4'e5b9ULL;
+    mixed          = (mixed ^ (mixed >> 27)) * 0x94d0'49bb'1331'11ebULL;
+    return mixed ^ (mixed >> 31);
+}
+
+/**
+ * @brief Minimal perfect hash of N keys, by hash and displace: a key's hash selects one of N buckets with the level
+ * seed, and the bucket's displacement seed then selects one of N slots, each holding exactly one key.
+ */
+template <size_t N> struct perfect_hash
+{
+    uint64_t                level_seed{};
+    std::array<uint64_t, N> displacement{};
+    std::array<size_t, N>   key_at{};
+
+    constexpr size_t slot_of(uint64_t hash) const noexcept
+    {
+        return reseed(hash, displacement[reseed(hash, level_seed) % N]) % N;
+    }
+};
+
+/**
+ * @brief Build the perfect hash of N distinct key hashes: buckets are placed largest first, each with the first
+ * displacement that sends its keys to distinct free slots. A level seed whose buckets cannot all be placed within a
+ * bounded number of displacements is replaced by the next one.
+ */
+template <size_t N> constexpr perfect_hash<N> make_perfect_hash(std::array<uint64_t, N> const& hashes)
+{
+    constexpr uint64_t max_displacement = 64 * N + 1024;
+    for (uint64_t level_seed = 1;; ++level_seed)
+    {
+        perfect_hash<N> table{level_seed, {}, {}};
+
+        // keys grouped by bucket, and buckets ordered by descending size, both by counting sort
+        std::array<size_t, N> bucket_of{};
+        std::array<size_t, N> bucket_size{};
+        for (size_t key = 0; key < N; ++key)
+        {
+            bucket_of[key] = reseed(hashes[key], level_seed) % N;
+            ++bucket_size[bucket_of[key]];
+        }
+        std::array<size_t, N + 1> bucket_start{};
+        for (size_t bucket = 0; bucket < N; ++bucket)
+        {
+            bucket_start[bucket + 1] = bucket_start[bucket] + bucket_size[bucket];
+        }
+        std::array<size_t, N> members{};
+        std::array<size_t, N> filled{};
+        for (size_t key = 0; key < N; ++key)
+        {
+            members[bucket_start[bucket_of[key]] + filled[bucket_of[key]]++] = key;
+        }
+        std::array<size_t, N + 2> size_start{};
+        for (size_t bucket = 0; bucket < N; ++bucket)
+        {
+            ++size_start[N - bucket_size[bucket] + 1];
+        }
+        for (size_t size = 0; size <= N; ++size)
+        {
+            size_start[size + 1] += size_start[size];
+        }
+        std::array<size_t, N> buckets{};
+        for (size_t bucket = 0; bucket < N; ++bucket)
+        {
+            buckets[size_start[N - bucket_size[bucket]]++] = bucket;
+        }
+
+        std::array<bool, N>   taken{};
+        std::array<size_t, N> slots{};
+        bool                  placed_all = true;
+        for (size_t const bucket : buckets)
+        {
+            size_t const  count         = bucket_size[bucket];
+            size_t const* bucket_member = members.data() + bucket_start[bucket];
+            if (count == 0)
+            {
+                break;
+            }
+
+            bool placed = false;
+            for (uint64_t displacement = 1; displacement <= max_displacement && !placed; ++displacement)
+            {
+                placed = true;
+                for (size_t member = 0; member < count && placed; ++member)
+                {
+                    slots[member] = reseed(hashes[bucket_member[member]], displacement) % N;
+                    placed        = !taken[slots[member]];
+                    for (size_t other = 0; other < member && placed; ++other)
+                    {
+                        placed = slots[other] != slots[member];
+                    }
+                }
+                if (placed)
+                {
+                    table.displacement[bucket] = displacement;
+                    for (size_t member = 0; member < count; ++member)
+                    {
+                        taken[slots[member]]        = true;
+                        table.key_at[slots[member]] = bucket_member[member];
+                    }
+                }
+            }
+            if (!placed)
+            {
+                placed_all = false;
+                break;
+            }
+        }
+        if (placed_all)
+        {
+            return table;
+        }
+    }
+}
+
+/**
+ * @brief True if no two of the values are equal; sorts them, so O(n log n).
+ */
+template <typename T, size_t N> constexpr bool are_distinct(std::array<T, N> values)
+{
+    std::sort(values.begin(), values.end());
+    return std::adjacent_find(values.begin(), values.end()) == values.end();
+}
+} // namespace detail
+
+/**
+ * @brief Map a run-time string-like to the index of the equal key among Keys, or npos, in constant time: one FNV-1a
+ * pass over the string, two table look-ups and a single comparison with the candidate key, instead of a comparison
+ * with every key in turn. The minimal perfect hash is computed at compile time.
+ *
+ * @code{.cpp}
+ * using verbs = util::string_switch<"GET", "POST", "PUT", "DELETE">;
+ * switch (verbs::index_of(token))
+ * {
+ *     case verbs::index<"GET">: return handle_get();
+ *     case verbs::index<"POST">: return handle_post();
+ *     case verbs::npos: return bad_request();
+ *     // ...
+ * }
+ * @endcode
+ *
+ * @tparam Keys distinct keys of one character type
+ */
+template <fixed_string... Keys> class string_switch
+{
+    using char_type = typename get_Nth_type_t<0, std::remove_cv_t<decltype(Keys)>..., fixed_string<0>>::value_type;
+
+    static_assert((std::is_same_v<typename std::remove_cv_t<decltype(Keys)>::value_type, char_type> && ...),
+                  "all keys of a string_switch must have the same character type");
+
+    using key_views_type = std::array<std::basic_string_view<char_type>, sizeof...(Keys)>;
+
+    static constexpr std::basic_string_view<char_type> keys_[sizeof...(Keys) + 1] = {Keys.view()..., {}};
+
+    // equal keys have equal hashes, so the keys themselves are only compared if two hashes are equal
+    static constexpr bool distinct_hashes_ =
+        detail::are_distinct(std::array<uint64_t, sizeof...(Keys)>{detail::fnv1a(Keys.view())...});
+    static_assert(distinct_hashes_ || detail::are_distinct(key_views_type{Keys.view()...}),
+                  "the keys of a string_switch must be distinct");
+    static_assert(distinct_hashes_ || !detail::are_distinct(key_views_type{Keys.view()...}),
+                  "FNV-1a collision between keys of a string_switch");
+
+    static constexpr auto table_ = []
+    {
+        if constexpr (sizeof...(Keys) == 0 || !distinct_hashes_)
+        {
+            return detail::perfect_hash<sizeof...(Keys)>{};
+        }
+        else
+        {
+            return detail::make_perfect_hash<sizeof...(Keys)>({detail::fnv1a(Keys.view())...});
+        }
+    }();
+
+  public:
+    static constexpr size_t size = sizeof...(Keys);
+
+    /**
+     * @brief Index returned for strings equal to none of the keys.
+     */
+    static constexpr size_t npos = size;
+
+    /**
+     * @brief Index of a key, at compile time; fails to compile for strings that are not keys.
+     */
+    template <fixed_string Key>
+    requires((Key.view() == Keys.view()) || ...)
+    static constexpr size_t index = []
+    {
+        size_t position = 0;
+        while (keys_[position] != Key.view())
+        {
+            ++position;
+        }
+        return position;
+    }();
+
+    /**
+     * @brief Index of the key equal to str, npos if there is none.
+     */
+    template <typename T>
+    requires is_compatible_string_v<T, std::basic_string_view<char_type>>
+    static constexpr size_t index_of(T const& str) noexcept
+    {
+        if constexpr (size == 0)
+        {
+            return npos;
+        }
+        else
+        {
+            auto const   view     = as_string_view(str);
+            size_t const position = table_.key_at[table_.slot_of(detail::fnv1a(view))];
+            return keys_[position] == view ? position : npos;
+        }
+    }
+
+    template <typename T>
+    requires is_compatible_string_v<T, std::basic_string_view<char_type>>
+    constexpr size_t operator()(T const& str) const noexcept
+    {
+        return index_of(str);
+    }
+};
+
+} // namespace util
+
+#endif // STRING_SWITCH_H_INCLUDED
@@ -27,6 +27,8 @@
 #ifndef TRAITS_H_INCLUDED
 #define TRAITS_H_INCLUDED
 
+#include "simd_scan.h"
+
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -38,6 +40,12 @@
     #include <concepts>
 #endif
 
+#if defined(__has_builtin)
+    #if __has_builtin(__type_pack_element)
+        #define TRAITS_HAS_TYPE_PACK_ELEMENT 1
+    #endif
+#endif
+
 namespace util
 {
 
@@ -53,6 +61,24 @@ template <typename... T> using is_tuple_t = typename is_tuple<T...>::type;
 
 template <typename... T> bool constexpr is_tuple_v = is_tuple<T...>::value;
 
+/**
+ * @brief Trait to identify tuple-like types: all types for which std::tuple_size is specialised, i.e. std::tuple,
+ * std::pair, std::array, std::ranges::subrange and user types opting in to structured bindings. Unlike is_tuple, cv-
+ * qualified types are recognised, as std::tuple_size is defined for them.
+ */
+template <typename T, typename = void> struct is_tuple_like : std::false_type
+{
+};
+
+template <typename T>
+struct is_tuple_like<T, std::void_t<decltype(std::tuple_size<T>::value)>> : std::true_type
+{
+};
+
+template <typename T> using is_tuple_like_t = typename is_tuple_like<T>::type;
+
+template <typename T> bool constexpr is_tuple_like_v = is_tuple_like<T>::value;
+
 #if __cplusplus >= 202'002L
 // C++20 Implementation using Concepts
 template <typename T, typename EqualTo = T>
@@ -68,6 +94,9 @@ concept less_comparable = requires(T a, LessThan b) {
 template <typename T>
 concept is_tuple_c = is_tuple_v<T>;
 
+template <typename T>
+concept is_tuple_like_c = is_tuple_like_v<std::remove_reference_t<T>>;
+
 #endif
 
 // Helper for equality comparability (C++14/17 fallback)
@@ -109,15 +138,111 @@ using is_less_comparable_t = typename is_less_comparable<T, LessThan>::type;
 template <typename T, typename LessThan = T>
 bool constexpr is_less_comparable_v = is_less_comparable<T, LessThan>::value;
 
-template <size_t N, typename T, typename... types> struct get_Nth_type
+namespace detail
 {
-    using type = typename get_Nth_type<N - 1, types...>::type;
+/**
+ * @brief Leaf of an indexed type-set: binds the index I to the type T.
+ */
+template <size_t I, typename T> struct indexed_type
+{
+    using type = T;
 };
 
-template <typename T, typename... types> struct get_Nth_type<0, T, types...>
+/**
+ * @brief Flat set of indexed leaves; inherits every indexed_type<I, T> at once, so building it does not recurse.
+ */
+template <typename IndexSeq, typename... Types> struct indexed_type_set;
+
+template <size_t... Is, typename... Types>
+struct indexed_type_set<std::index_sequence<Is...>, Types...> : indexed_type<Is, Types>...
+{
+};
+
+/**
+ * @brief Overload-set lookup: deduces T from the unique base indexed_type<I, T> (never defined, unevaluated only).
+ */
+template <size_t I, typename T> indexed_type<I, T> select_indexed_type(indexed_type<I, T> const*);
+
+/**
+ * @brief Portable constant-depth N-th type lookup used when no compiler builtin is available.
+ */
+template <size_t N, typename... Types>
+using nth_type_by_overload_t = typename decltype(select_indexed_type<N>(
+    static_cast<indexed_type_set<std::index_sequence_for<Types...>, Types...> const*>(nullptr)
+))::type;
+
+/**
+ * @brief Overload-set lookup: deduces I from the base indexed_type<I, T>; fails if T occurs zero or several times.
+ */
+template <typename T, size_t I> std::integral_constant<size_t, I> select_type_index(indexed_type<I, T> const*);
+
+/**
+ * @brief Position of the first T in Types..., or sizeof...(Types) if T is not in the pack.
+ */
+template <typename T, typename... Types> constexpr size_t find_type_index()
+{
+    constexpr bool matches[] = {std::is_same_v<T, Types>..., true}; // sentinel terminates the scan
+    size_t         index     = 0;
+    while (!matches[index])
+    {
+        ++index;
+    }
+    return index;
+}
+
+/**
+ * @brief Index of T in Types...; the linear scan is only needed when T is absent or occurs more than once.
+ */
+template <typename T, typename TypeSet, typename... Types>
+struct type_index_lookup : std::integral_constant<size_t, find_type_index<T, Types...>()>
+{
+};
+
+/**
+ * @brief Index of T in Types... when T occurs exactly once: deduced from the unique base, no comparisons.
+ */
+template <typename T, typename TypeSet, typename... Types>
+requires requires { select_type_index<T>(static_cast<TypeSet const*>(nullptr)); }
+struct type_index_lookup<T, TypeSet, Types...> : decltype(select_type_index<T>(static_cast<TypeSet const*>(nullptr)))
 {
-    using type = T;
 };
+} // namespace detail
+
+/**
+ * @brief Select the N-th type of the pack Types... .
+ * The lookup has constant template depth: it uses C++26 pack indexing or the __type_pack_element builtin when the
+ * compiler provides them and an index-sequence/overload-set lookup otherwise.
+ *
+ * @tparam N zero-based index into the pack
+ * @tparam Types the pack to index
+ */
+template <size_t N, typename... Types> struct get_Nth_type
+{
+    static_assert(N < sizeof...(Types), "get_Nth_type: index out of range");
+#if defined(__cpp_pack_indexing)
+    using type = Types...[N];
+#elif defined(TRAITS_HAS_TYPE_PACK_ELEMENT)
+    using type = __type_pack_element<N, Types...>;
+#else
+    using type = detail::nth_type_by_overload_t<N, Types...>;
+#endif
+};
+
+template <size_t N, typename... Types> using get_Nth_type_t = typename get_Nth_type<N, Types...>::type;
+
+/**
+ * @brief Zero-based index of the first occurrence of T in Types..., sizeof...(Types) if T does not occur.
+ *
+ * @tparam T the type to look for
+ * @tparam Types the pack to search
+ */
+template <typename T, typename... Types>
+struct index_of_type
+    : detail::type_index_lookup<T, detail::indexed_type_set<std::index_sequence_for<Types...>, Types...>, Types...>
+{
+};
+
+template <typename T, typename... Types> constexpr size_t index_of_type_v = index_of_type<T, Types...>::value;
 
 /**
  * @brief Trait to identify custom character types. Default is false.
@@ -159,212 +284,249 @@ template <typename T> using is_char_t = typename is_char<T>::type;
 template <typename T> bool constexpr is_char_v = is_char<T>::value;
 
 /**
- * @brief Trait to identify std-string types. Default is false.
+ * @brief The kinds of "logical strings" the string traits distinguish.
  */
-template <typename> struct is_std_string : std::false_type
+enum class string_kind : std::uint8_t
 {
-    using char_type = void;
+    none,            ///< not a logical string
+    std_string,      ///< std::basic_string
+    std_string_view, ///< std::basic_string_view
+    char_pointer,    ///< pointer to a character type
+    char_array,      ///< array of a character type
+    fixed_string     ///< util::fixed_string (see fixed_string.h)
 };
 
+namespace detail
+{
 /**
- * @brief Trait to identify std-string types. Specialization for "std::basic_string" is true.
+ * @brief Classification of pointers to/arrays of CharT: Kind if CharT is a character, string_kind::none otherwise.
  */
-template <typename CharT, typename Traits, typename Alloc>
-struct is_std_string<std::basic_string<CharT, Traits, Alloc>> : std::true_type
+template <typename CharT, string_kind Kind, bool = is_char_v<CharT>> struct char_sequence_classification
 {
-    using char_type = CharT;
+    static constexpr string_kind kind = string_kind::none;
+    using char_type                   = void;
 };
 
-template <typename T> using is_std_string_t = typename is_std_string<T>::type;
-
-template <typename T> bool constexpr is_std_string_v = is_std_string<T>::value;
+template <typename CharT, string_kind Kind> struct char_sequence_classification<CharT, Kind, true>
+{
+    static constexpr string_kind kind = Kind;
+    using char_type                   = CharT;
+};
+} // namespace detail
 
 /**
- * @brief Convert a char to a different char type
+ * @brief Classify a type as logical string in a single partial-specialization lookup. All string traits below are
+ * built on this classification, so each type is classified once no matter how many of them are queried.
+ * Default is string_kind::none with char_type void.
  *
- * @tparam CharTto_ type to convert to
- * @tparam CharTfrom_ type to convert from
- * @param c the char to convert
- * @return constexpr CharTto_ the converted char
+ * @tparam T type to classify
  */
-template <typename CharTto_, typename CharTfrom_>
-requires util::is_char_v<CharTto_> && util::is_char_v<CharTfrom_>
-constexpr CharTto_ charToChar(CharTfrom_ c)
+template <typename T> struct string_classification
 {
-    return static_cast<CharTto_>(c);
-}
+    static constexpr string_kind kind = string_kind::none;
+    using char_type                   = void;
+};
 
 /**
- * @brief Trait to identify std-string-view types. Default is false.
+ * @brief String classification. Specialization for "std::basic_string".
  */
-template <typename U> struct is_std_string_view : std::false_type
+template <typename CharT, typename Traits, typename Alloc>
+struct string_classification<std::basic_string<CharT, Traits, Alloc>>
 {
-    using char_type = void;
+    static constexpr string_kind kind = string_kind::std_string;
+    using char_type                   = CharT;
 };
 
 /**
- * @brief Trait to identify std-string types. Specialization for "std::basic_string_view" is true.
+ * @brief String classification. Specialization for "std::basic_string_view".
  */
-template <typename CharT, typename Traits>
-struct is_std_string_view<std::basic_string_view<CharT, Traits>> : std::true_type
+template <typename CharT, typename Traits> struct string_classification<std::basic_string_view<CharT, Traits>>
 {
-    using char_type = CharT;
+    static constexpr string_kind kind = string_kind::std_string_view;
+    using char_type                   = CharT;
 };
 
-template <typename T> using is_std_string_view_t = typename is_std_string_view<T>::type;
+/**
+ * @brief String classification. Specialization for "CharT*", a string if CharT is a character.
+ */
+template <typename CharT>
+struct string_classification<CharT*> : detail::char_sequence_classification<CharT, string_kind::char_pointer>
+{
+};
 
-template <typename T> bool constexpr is_std_string_view_v = is_std_string_view<T>::value;
+/**
+ * @brief String classification. Specialization for "const CharT*", a string if CharT is a character.
+ */
+template <typename CharT>
+struct string_classification<CharT const*> : detail::char_sequence_classification<CharT, string_kind::char_pointer>
+{
+};
 
 /**
- * @brief Trait to identify character pointer types. Default is false.
+ * @brief String classification. Specialization for "const CharT*&", a string if CharT is a character.
  */
-template <typename U> struct is_char_pointer : std::false_type
+template <typename CharT>
+struct string_classification<CharT const*&> : detail::char_sequence_classification<CharT, string_kind::char_pointer>
 {
-    using char_type = void;
 };
 
 /**
- * @brief Trait to identify character pointer types. Specialization for "CharT*" is true, if CharT is a character.
+ * @brief String classification. Specialization for "CharT*&", a string if CharT is a character.
  */
-template <typename CharT> struct is_char_pointer<CharT*>
+template <typename CharT>
+struct string_classification<CharT*&> : detail::char_sequence_classification<CharT, string_kind::char_pointer>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
 /**
- * @brief Trait to identify character pointer types. Specialization for "const CharT*" is true, if CharT is a character.
+ * @brief String classification. Specialization for "const CharT* const", a string if CharT is a character.
  */
-template <typename CharT> struct is_char_pointer<CharT const*>
+template <typename CharT>
+struct string_classification<CharT const* const>
+    : detail::char_sequence_classification<CharT, string_kind::char_pointer>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
 /**
- * @brief Trait to identify character pointer types. Specialization for "const CharT*&" is true, if CharT is a
- * character.
+ * @brief String classification. Specialization for "CharT[]", a string if CharT is a character.
  */
-template <typename CharT> struct is_char_pointer<CharT const*&>
+template <typename CharT>
+struct string_classification<CharT[]> : detail::char_sequence_classification<CharT, string_kind::char_array>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
 /**
- * @brief Trait to identify character pointer types. Specialization for "CharT*&" is true, if CharT is a
- * character.
+ * @brief String classification. Specialization for "CharT[sz]", a string if CharT is a character.
  */
-template <typename CharT> struct is_char_pointer<CharT*&>
+template <typename CharT, size_t sz>
+struct string_classification<CharT[sz]> : detail::char_sequence_classification<CharT, string_kind::char_array>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
 /**
- * @brief Trait to identify character pointer types. Specialization for "const CharT* const" is true, if CharT is a
- * character.
+ * @brief String classification. Specialization for "const CharT[]", a string if CharT is a character.
  */
-template <typename CharT> struct is_char_pointer<CharT const* const>
+template <typename CharT>
+struct string_classification<CharT const[]> : detail::char_sequence_classification<CharT, string_kind::char_array>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
-template <typename CharT> using is_char_pointer_t = typename is_char_pointer<CharT>::type;
+/**
+ * @brief String classification. Specialization for "const CharT[sz]", a string if CharT is a character.
+ */
+template <typename CharT, size_t sz>
+struct string_classification<CharT const[sz]> : detail::char_sequence_classification<CharT, string_kind::char_array>
+{
+};
 
-template <typename CharT> bool constexpr is_char_pointer_v = is_char_pointer<CharT>::value;
+template <typename T> constexpr string_kind string_kind_v = string_classification<T>::kind;
 
+template <typename T> using string_char_t = typename string_classification<T>::char_type;
+
+namespace detail
+{
 /**
- * @brief Trait to identify character array types. Default is false.
+ * @brief Common base of the per-kind string traits: true with the classified char_type if T is of kind Kind.
  */
-template <typename U> struct is_char_array : std::false_type
+template <typename T, string_kind Kind, bool = (string_kind_v<T> == Kind)> struct is_string_of_kind : std::false_type
 {
     using char_type = void;
 };
 
+template <typename T, string_kind Kind> struct is_string_of_kind<T, Kind, true> : std::true_type
+{
+    using char_type = string_char_t<T>;
+};
+} // namespace detail
+
 /**
- * @brief Trait to identify character array types. Specialization for "CharT[]" is true, if CharT is a character.
+ * @brief Trait to identify std-string types: true for "std::basic_string".
  */
-template <typename CharT> struct is_char_array<CharT[]>
+template <typename T> struct is_std_string : detail::is_string_of_kind<T, string_kind::std_string>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
+template <typename T> using is_std_string_t = typename is_std_string<T>::type;
+
+template <typename T> bool constexpr is_std_string_v = string_kind_v<T> == string_kind::std_string;
+
+/**
+ * @brief Convert a char to a different char type
+ *
+ * @tparam CharTto_ type to convert to
+ * @tparam CharTfrom_ type to convert from
+ * @param c the char to convert
+ * @return constexpr CharTto_ the converted char
+ */
+template <typename CharTto_, typename CharTfrom_>
+requires util::is_char_v<CharTto_> && util::is_char_v<CharTfrom_>
+constexpr CharTto_ charToChar(CharTfrom_ c)
+{
+    return static_cast<CharTto_>(c);
+}
+
 /**
- * @brief Trait to identify character array types. Specialization for "CharT[sz]" is true, if CharT is a character.
+ * @brief Trait to identify std-string-view types: true for "std::basic_string_view".
  */
-template <typename CharT, size_t sz> struct is_char_array<CharT[sz]>
+template <typename T> struct is_std_string_view : detail::is_string_of_kind<T, string_kind::std_string_view>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
+template <typename T> using is_std_string_view_t = typename is_std_string_view<T>::type;
+
+template <typename T> bool constexpr is_std_string_view_v = string_kind_v<T> == string_kind::std_string_view;
+
 /**
- * @brief Trait to identify character array types. Specialization for "const CharT[]" is true, if CharT is a character.
+ * @brief Trait to identify character pointer types: true for "CharT*", "const CharT*", "CharT*&", "const CharT*&" and
+ * "const CharT* const" if CharT is a character.
  */
-template <typename CharT> struct is_char_array<CharT const[]>
+template <typename T> struct is_char_pointer : detail::is_string_of_kind<T, string_kind::char_pointer>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
+template <typename CharT> using is_char_pointer_t = typename is_char_pointer<CharT>::type;
+
+template <typename CharT> bool constexpr is_char_pointer_v = string_kind_v<CharT> == string_kind::char_pointer;
+
 /**
- * @brief Trait to identify character array types. Specialization for "const CharT[sz]" is true, if CharT is a
- * character.
+ * @brief Trait to identify character array types: true for "CharT[]", "CharT[sz]", "const CharT[]" and
+ * "const CharT[sz]" if CharT is a character.
  */
-template <typename CharT, size_t sz> struct is_char_array<CharT const[sz]>
+template <typename T> struct is_char_array : detail::is_string_of_kind<T, string_kind::char_array>
 {
-    static constexpr bool value = is_char_v<CharT>;
-    using char_type             = typename std::conditional_t<value, CharT, void>;
 };
 
 template <typename CharT> using is_char_array_t = typename is_char_array<CharT>::type;
 
-template <typename CharT> bool constexpr is_char_array_v = is_char_array<CharT>::value;
+template <typename CharT> bool constexpr is_char_array_v = string_kind_v<CharT> == string_kind::char_array;
 
 /**
  * @brief Trait to identify "logical strings": char* char-arrays, string_views and strings.
  *
  * @tparam T type to check
  */
-template <typename T> struct is_string
+template <typename T> struct is_string : std::bool_constant<string_kind_v<T> != string_kind::none>
 {
-    // Check for custom string-like types
-    static constexpr bool is_std_string_val      = is_std_string_v<T>;
-    static constexpr bool is_std_string_view_val = is_std_string_view_v<T>;
-    static constexpr bool is_char_pointer_val    = is_char_pointer_v<T>;
-    static constexpr bool is_char_array_val      = is_char_array_v<T>;
+    static constexpr string_kind kind = string_kind_v<T>;
 
-    static constexpr bool value =
-        is_std_string_val || is_std_string_view_val || is_char_pointer_val || is_char_array_val;
-    using __str_char_type    = typename is_std_string<T>::char_type;
-    using __str_vw_char_type = typename is_std_string_view<T>::char_type;
-    using __pchr_char_type   = typename is_char_pointer<T>::char_type;
-    using __Achr_char_type   = typename is_char_array<T>::char_type;
+    static constexpr bool is_std_string_val      = kind == string_kind::std_string;
+    static constexpr bool is_std_string_view_val = kind == string_kind::std_string_view;
+    static constexpr bool is_char_pointer_val    = kind == string_kind::char_pointer;
+    static constexpr bool is_char_array_val      = kind == string_kind::char_array;
 
-    // clang-format off
-    using char_type = typename std::conditional_t<is_std_string_val,
-                                       __str_char_type,
-                                       typename std::conditional_t<is_std_string_view_val,
-                                                          __str_vw_char_type,
-                                                          typename std::conditional_t<is_char_pointer_val,
-                                                                             __pchr_char_type,
-                                                                             __Achr_char_type>>>;
-    // clang-format on
+    using char_type = string_char_t<T>;
 };
 
 template <typename T> using is_string_t = typename is_string<T>::type;
 
-template <typename T> bool constexpr is_string_v = is_string<T>::value;
+template <typename T> bool constexpr is_string_v = string_kind_v<T> != string_kind::none;
 
 template <typename StringT1_, typename StringT2_> struct is_compatible_string
 {
     static constexpr bool is_string_1    = is_string_v<StringT1_>;
     static constexpr bool is_string_2    = is_string_v<StringT2_>;
-    using char_type_1                    = typename is_string<StringT1_>::char_type;
-    using char_type_2                    = typename is_string<StringT2_>::char_type;
+    using char_type_1                    = string_char_t<StringT1_>;
+    using char_type_2                    = string_char_t<StringT2_>;
     static constexpr bool same_char_type = std::is_same_v<char_type_1, char_type_2>;
 
     constexpr static bool value = is_string_1 && is_string_2 && same_char_type;
@@ -375,12 +537,13 @@ template <typename StringT1_, typename StringT2_>
 using is_compatible_string_t = typename is_compatible_string<StringT1_, StringT2_>::type;
 
 template <typename StringT1_, typename StringT2_>
-bool constexpr is_compatible_string_v = is_compatible_string<StringT1_, StringT2_>::value;
+bool constexpr is_compatible_string_v = is_string_v<StringT1_> && is_string_v<StringT2_> &&
+                                       std::is_same_v<string_char_t<StringT1_>, string_char_t<StringT2_>>;
 
 template <typename StringT_, typename StringOrCharT_> struct has_std_string_compatible_char
 {
     // clang-format off
-    using string_char_type = typename is_string<StringT_>::char_type ;
+    using string_char_type = string_char_t<StringT_>;
 
     static constexpr bool is_std_string_1st_val    = is_std_string_v<StringT_>;
     static constexpr bool is_compatible_string_val = is_compatible_string_v<StringT_, StringOrCharT_>;
@@ -396,53 +559,159 @@ template <typename StringT1_, typename StringOrCharT_>
 using has_std_string_compatible_char_t = typename has_std_string_compatible_char<StringT1_, StringOrCharT_>::type;
 
 template <typename StringT1_, typename StringOrCharT_>
-bool constexpr has_std_string_compatible_char_v = has_std_string_compatible_char<StringT1_, StringOrCharT_>::value;
+bool constexpr has_std_string_compatible_char_v =
+    is_compatible_string_v<StringT1_, StringOrCharT_> ||
+    (is_char_v<StringOrCharT_> && std::is_same_v<string_char_t<StringT1_>, StringOrCharT_>);
+
+/**
+ * @brief Extent value of string-likes whose size is only known at runtime.
+ */
+inline constexpr size_t dynamic_extent = ~size_t{0};
+
+/**
+ * @brief Compile-time bound of the size of a string-like, if it has one: string_or_char_size never returns more.
+ * Default is dynamic_extent.
+ */
+template <typename T> struct static_extent : std::integral_constant<size_t, dynamic_extent>
+{
+};
+
+/**
+ * @brief Compile-time bound of the size of a string-like. Specialization for "CharT[sz]": an array without terminator
+ * has sz characters.
+ */
+template <typename CharT, size_t sz>
+requires util::is_char_v<CharT>
+struct static_extent<CharT[sz]> : std::integral_constant<size_t, sz>
+{
+};
+
+/**
+ * @brief Compile-time bound of the size of a string-like. Specialization for "const CharT[sz]".
+ */
+template <typename CharT, size_t sz>
+requires util::is_char_v<CharT>
+struct static_extent<CharT const[sz]> : std::integral_constant<size_t, sz>
+{
+};
+
+/**
+ * @brief Compile-time bound of the size of a string-like. Specialization for single characters.
+ */
+template <typename CharT>
+requires util::is_char_v<CharT>
+struct static_extent<CharT> : std::integral_constant<size_t, 1>
+{
+};
+
+template <typename T> constexpr size_t static_extent_v = static_extent<T>::value;
 
 template <typename T>
-requires util::is_std_string_v<T> || util::is_std_string_view_v<T>
-size_t string_or_char_size(T const& str)
+requires(string_kind_v<T> == string_kind::std_string || string_kind_v<T> == string_kind::std_string_view ||
+         string_kind_v<T> == string_kind::fixed_string)
+constexpr size_t string_or_char_size(T const& str)
 {
     return std::ssize(str);
 }
 
+/**
+ * @brief Length of a null-terminated character pointer. Uses the vectorised terminator scan at runtime.
+ */
 template <typename T>
-requires util::is_char_pointer_v<T> || util::is_char_array_v<T>
-size_t string_or_char_size(T const& str)
-{
-    using char_type = util::is_string<T>::char_type;
-    return std::char_traits<char_type>::length(str);
+requires(string_kind_v<T> == string_kind::char_pointer)
+constexpr size_t string_or_char_size(T const& str)
+{
+    using char_type = string_char_t<T>;
+    if consteval
+    {
+        return std::char_traits<char_type>::length(str);
+    }
+    else
+    {
+        return simd::terminator_scan(str);
+    }
+}
+
+/**
+ * @brief Length of the string in a character array. For a bounded array the scan never goes past the bound, so an
+ * array without terminator has the length of its bound.
+ */
+template <typename T>
+requires(string_kind_v<T> == string_kind::char_array)
+constexpr size_t string_or_char_size(T const& str)
+{
+    using char_type         = string_char_t<T>;
+    constexpr size_t extent = std::extent_v<T>;
+    constexpr size_t limit  = extent == 0 ? dynamic_extent : extent;
+    if consteval
+    {
+        if constexpr (extent == 0)
+        {
+            return std::char_traits<char_type>::length(str);
+        }
+        else
+        {
+            char_type const* terminator = std::char_traits<char_type>::find(str, extent, char_type{});
+            return terminator == nullptr ? extent : static_cast<size_t>(terminator - str);
+        }
+    }
+    else
+    {
+        return simd::terminator_scan(static_cast<char_type const*>(str), limit);
+    }
 }
 
 template <typename T>
 requires util::is_char_v<T>
-size_t string_or_char_size(T const&)
+constexpr size_t string_or_char_size(T const&)
 {
     return 1UL;
 }
 
 template <typename T>
 requires(!util::is_string_v<T> && !util::is_char_v<T>)
-size_t string_or_char_size(T const& /* str */)
+constexpr size_t string_or_char_size(T const& /* str */)
 {
     return 0UL;
 }
 
-// Primary template to check if std::hash<Type> exists and is callable with const Type&
-template <typename Type, typename = void> struct has_std_hash : std::false_type
+/**
+ * @brief View on the characters of a string-like: the whole std::basic_string or std::basic_string_view, character
+ * pointers and arrays up to their terminator (see string_or_char_size).
+ */
+template <typename T>
+requires util::is_string_v<T>
+constexpr std::basic_string_view<string_char_t<T>> as_string_view(T const& str)
+{
+    if constexpr (is_std_string_v<T> || is_std_string_view_v<T> || string_kind_v<T> == string_kind::fixed_string)
+    {
+        return {str.data(), str.size()};
+    }
+    else
+    {
+        return {str, string_or_char_size(str)};
+    }
+}
+
+// Primary template to check if Hasher - by default std::hash<Type> - exists and is callable with const Type&, e.g.
+// has_std_hash_v<std::tuple<std::string, int>, util::hash<std::tuple<std::string, int>>> (see tuple_hash.h)
+template <typename Type, typename Hasher = std::hash<Type>, typename = void> struct has_std_hash : std::false_type
 {
 };
 
-// Specialization for when std::hash<Type> is well-formed and callable
-template <typename Type>
-struct has_std_hash<Type, std::void_t<decltype(std::declval<std::hash<Type>>()(std::declval<Type const&>()))>>
-    : std::is_same<decltype(std::declval<std::hash<Type>>()(std::declval<Type const&>())), size_t>
+// Specialization for when Hasher is well-formed and callable
+template <typename Type, typename Hasher>
+struct has_std_hash<Type, Hasher, std::void_t<decltype(std::declval<Hasher>()(std::declval<Type const&>()))>>
+    : std::is_same<decltype(std::declval<Hasher>()(std::declval<Type const&>())), size_t>
 {
 };
 
-template <typename Type> using has_std_hash_t = typename has_std_hash<Type>::type;
+template <typename Type, typename Hasher = std::hash<Type>>
+using has_std_hash_t = typename has_std_hash<Type, Hasher>::type;
 
 // Helper variable template (for C++14 and above)
-template <typename Type> constexpr bool has_std_hash_v = has_std_hash<Type>::value;
+template <typename Type, typename Hasher = std::hash<Type>>
+constexpr bool has_std_hash_v = has_std_hash<Type, Hasher>::value;
 
 } //  namespace util
 
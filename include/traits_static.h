@@ -109,4 +109,94 @@
                                                                                                                        \
     template <typename U> inline constexpr bool traitsName##_v = traitsName<U>::value;
 
+#if __cplusplus >= 202'002L
+/**
+ * @brief Macro to define a concept that checks whether a class has a static member function of a given signature.
+ * Unlike DEFINE_HAS_STATIC_MEMBER_FUNCTION it expands to a single requires-expression, with no class template or
+ * helper overloads to instantiate per checked type.
+ * @usage
+ * The first parameter is the name of the concept, the second the plain name of the member function and the rest its
+ * function type. A noexcept in the function type is required of the member, without it both are accepted; of
+ * overloaded members the one matching the function type is picked.
+ *
+ * @code{.cpp}
+ * DEFINE_HAS_STATIC_MEMBER_CONCEPT(has_static_bool_fill, fill, bool(int, int) noexcept)
+ *
+ * struct Test1
+ * {
+ *     static bool fill(int, int) noexcept { return false; }
+ * };
+ *
+ * static_assert(has_static_bool_fill<Test1>);
+ * @endcode
+ */
+    #define DEFINE_HAS_STATIC_MEMBER_CONCEPT(conceptName, funcName, ...)                                              \
+        template <typename T>                                                                                          \
+        concept conceptName = requires { static_cast<std::type_identity_t<__VA_ARGS__>*>(&T::funcName); };
+
+/**
+ * @brief Macro to define a concept that checks whether a class has a non-static member function of a given signature.
+ * Unlike DEFINE_HAS_MEMBER_FUNCTION it expands to a single requires-expression, with no class template or helper
+ * overloads to instantiate per checked type.
+ * @usage
+ * The first parameter is the name of the concept, the second the name of the member function and the rest its
+ * function type, including the const/volatile qualifiers, which must match exactly. A noexcept in the function type
+ * is required of the member, without it both are accepted. Of overloaded members the one matching the function type
+ * is picked.
+ *
+ * @code{.cpp}
+ * DEFINE_HAS_MEMBER_CONCEPT(has_const_bool_fill, fill, bool(int) const noexcept)
+ *
+ * struct Test1
+ * {
+ *     bool fill(int) const noexcept { return false; }
+ * };
+ *
+ * struct Test2
+ * {
+ *     bool fill(int) noexcept { return false; } // not const!
+ * };
+ *
+ * static_assert(has_const_bool_fill<Test1>);
+ * static_assert(!has_const_bool_fill<Test2>);
+ * @endcode
+ */
+    #define DEFINE_HAS_MEMBER_CONCEPT(conceptName, funcName, ...)                                                     \
+        template <typename T>                                                                                          \
+        concept conceptName = requires { static_cast<std::type_identity_t<__VA_ARGS__> T::*>(&T::funcName); };
+
+namespace util
+{
+/**
+ * @brief Concept equivalent to DEFINE_HAS_MEMBER_CONCEPT without a macro, so that it can be exported from the
+ * dkyb.traits module, which cannot export macros. The member name is supplied by a probe: a captureless generic lambda
+ * that assigns the member's address to the pointer it is passed. The assignment picks the overload matching the
+ * function type and, as with the macro, accepts a noexcept member for a function type without noexcept.
+ *
+ * @code{.cpp}
+ * inline constexpr auto fill_probe = []<typename T>(auto& target) -> decltype(target = &T::fill) { return target; };
+ *
+ * static_assert(util::has_member_function_c<Test1, bool(int) const noexcept, fill_probe>);
+ * @endcode
+ */
+template <typename T, typename Signature, auto Probe>
+concept has_member_function_c =
+    requires(std::type_identity_t<Signature> T::*target) { Probe.template operator()<T>(target); };
+
+/**
+ * @brief Concept equivalent to DEFINE_HAS_STATIC_MEMBER_CONCEPT without a macro; the probe is written as for
+ * has_member_function_c and is passed a plain function pointer.
+ *
+ * @code{.cpp}
+ * inline constexpr auto make_probe = []<typename T>(auto& target) -> decltype(target = &T::make) { return target; };
+ *
+ * static_assert(util::has_static_member_function_c<Test1, int(int, char), make_probe>);
+ * @endcode
+ */
+template <typename T, typename Signature, auto Probe>
+concept has_static_member_function_c =
+    requires(std::type_identity_t<Signature>* target) { Probe.template operator()<T>(target); };
+} // namespace util
+#endif
+
 #endif // TRAITS_STATIC_H_INCLUDED
@@ -0,0 +1,519 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/transcode.h
+ * Description: Bulk and streaming transcoding between the Unicode encodings of the character types.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef TRANSCODE_H_INCLUDED
+#define TRANSCODE_H_INCLUDED
+
+#include "simd_scan.h"
+#include "traits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace util
+{
+
+/**
+ * @brief Unicode encoding forms of the character types.
+ */
+enum class unicode_encoding : std::uint8_t
+{
+    utf8,  ///< 1-byte code units
+    utf16, ///< 2-byte code units, supplementary planes as surrogate pairs
+    utf32  ///< 4-byte code units, one per code point
+};
+
+/**
+ * @brief Encoding of the code units of a character type, decided by its size: char is UTF-8, char16_t UTF-16,
+ * char32_t UTF-32 and wchar_t UTF-16 or UTF-32 depending on the platform.
+ */
+template <typename CharT>
+requires is_char_v<CharT>
+inline constexpr unicode_encoding encoding_of_v = sizeof(CharT) == 1   ? unicode_encoding::utf8
+                                                  : sizeof(CharT) == 2 ? unicode_encoding::utf16
+                                                                       : unicode_encoding::utf32;
+
+/**
+ * @brief Outcome of a transcoding step.
+ */
+enum class transcode_status : std::uint8_t
+{
+    ok,       ///< all input converted
+    invalid,  ///< ill-formed input: bad lead or continuation unit, overlong form, lone surrogate or out of range
+    truncated ///< the input ends inside a multi-unit sequence
+};
+
+/**
+ * @brief Result of transcode() and transcoder::feed().
+ */
+struct transcode_result
+{
+    transcode_status status   = transcode_status::ok;
+    size_t           position = 0; ///< input code units consumed; on error the index of the offending sequence
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return status == transcode_status::ok;
+    }
+};
+
+namespace detail
+{
+/**
+ * @brief Unsigned value of a code unit.
+ */
+template <typename CharT> constexpr std::uint32_t unit_value(CharT unit) noexcept
+{
+    return static_cast<typename simd::detail::unit_type<sizeof(CharT)>::type>(unit);
+}
+
+/**
+ * @brief One decoded code point and the number of code units it occupied.
+ */
+struct decoded_code_point
+{
+    char32_t         code_point;
+    size_t           length;
+    transcode_status status;
+};
+
+/**
+ * @brief Decode the code point at the start of the non-empty sequence [in, in + size).
+ */
+template <typename CharT> constexpr decoded_code_point decode_one(CharT const* in, size_t size) noexcept
+{
+    std::uint32_t const lead = unit_value(in[0]);
+    if constexpr (encoding_of_v<CharT> == unicode_encoding::utf8)
+    {
+        if (lead < 0x80U)
+        {
+            return {lead, 1, transcode_status::ok};
+        }
+        // C0/C1 only start overlong forms, F5..FF code points beyond U+10FFFF
+        if (lead < 0xC2U || lead > 0xF4U)
+        {
+            return {0, 1, transcode_status::invalid};
+        }
+        size_t const  length     = lead < 0xE0U ? 2 : lead < 0xF0U ? 3 : 4;
+        char32_t      code_point = lead & (0x7FU >> length);
+        std::uint32_t low        = 0x80U;
+        std::uint32_t high       = 0xBFU;
+        // the second unit excludes overlong forms, surrogates and values beyond U+10FFFF
+        if (lead == 0xE0U)
+        {
+            low = 0xA0U;
+        }
+        else if (lead == 0xEDU)
+        {
+            high = 0x9FU;
+        }
+        else if (lead == 0xF0U)
+        {
+            low = 0x90U;
+        }
+        else if (lead == 0xF4U)
+        {
+            high = 0x8FU;
+        }
+        for (size_t index = 1; index < length; ++index)
+        {
+            if (index == size)
+            {
+                return {0, index, transcode_status::truncated};
+            }
+            std::uint32_t const unit = unit_value(in[index]);
+            if (unit < low || unit > high)
+            {
+                return {0, index, transcode_status::invalid};
+            }
+            code_point = (code_point << 6) | (unit & 0x3FU);
+            low        = 0x80U;
+            high       = 0xBFU;
+        }
+        return {code_point, length, transcode_status::ok};
+    }
+    else if constexpr (encoding_of_v<CharT> == unicode_encoding::utf16)
+    {
+        if (lead < 0xD800U || lead > 0xDFFFU)
+        {
+            return {lead, 1, transcode_status::ok};
+        }
+        if (lead > 0xDBFFU)
+        {
+            return {0, 1, transcode_status::invalid};
+        }
+        if (size == 1)
+        {
+            return {0, 1, transcode_status::truncated};
+        }
+        std::uint32_t const trail = unit_value(in[1]);
+        if (trail < 0xDC00U || trail > 0xDFFFU)
+        {
+            return {0, 1, transcode_status::invalid};
+        }
+        return {0x10000U + ((lead - 0xD800U) << 10) + (trail - 0xDC00U), 2, transcode_status::ok};
+    }
+    else
+    {
+        if (lead > 0x10FFFFU || (lead >= 0xD800U && lead <= 0xDFFFU))
+        {
+            return {0, 1, transcode_status::invalid};
+        }
+        return {lead, 1, transcode_status::ok};
+    }
+}
+
+/**
+ * @brief Encode a valid code point at out and return the number of code units written.
+ */
+template <typename CharT> constexpr size_t encode_one(char32_t code_point, CharT* out) noexcept
+{
+    if constexpr (encoding_of_v<CharT> == unicode_encoding::utf8)
+    {
+        if (code_point < 0x80U)
+        {
+            out[0] = static_cast<CharT>(code_point);
+            return 1;
+        }
+        if (code_point < 0x800U)
+        {
+            out[0] = static_cast<CharT>(0xC0U | (code_point >> 6));
+            out[1] = static_cast<CharT>(0x80U | (code_point & 0x3FU));
+            return 2;
+        }
+        if (code_point < 0x10000U)
+        {
+            out[0] = static_cast<CharT>(0xE0U | (code_point >> 12));
+            out[1] = static_cast<CharT>(0x80U | ((code_point >> 6) & 0x3FU));
+            out[2] = static_cast<CharT>(0x80U | (code_point & 0x3FU));
+            return 3;
+        }
+        out[0] = static_cast<CharT>(0xF0U | (code_point >> 18));
+        out[1] = static_cast<CharT>(0x80U | ((code_point >> 12) & 0x3FU));
+        out[2] = static_cast<CharT>(0x80U | ((code_point >> 6) & 0x3FU));
+        out[3] = static_cast<CharT>(0x80U | (code_point & 0x3FU));
+        return 4;
+    }
+    else if constexpr (encoding_of_v<CharT> == unicode_encoding::utf16)
+    {
+        if (code_point < 0x10000U)
+        {
+            out[0] = static_cast<CharT>(code_point);
+            return 1;
+        }
+        code_point -= 0x10000U;
+        out[0] = static_cast<CharT>(0xD800U + (code_point >> 10));
+        out[1] = static_cast<CharT>(0xDC00U + (code_point & 0x3FFU));
+        return 2;
+    }
+    else
+    {
+        out[0] = static_cast<CharT>(code_point);
+        return 1;
+    }
+}
+
+/**
+ * @brief Upper bound of output code units per input code unit.
+ */
+template <typename FromChar, typename ToChar> inline constexpr size_t max_expansion_v = [] {
+    constexpr unicode_encoding from = encoding_of_v<FromChar>;
+    constexpr unicode_encoding to   = encoding_of_v<ToChar>;
+    if constexpr (to == unicode_encoding::utf8)
+    {
+        // a BMP code point takes one UTF-16 unit and up to 3 bytes, any code point one UTF-32 unit and up to 4 bytes
+        return from == unicode_encoding::utf8 ? 1 : from == unicode_encoding::utf16 ? 3 : 4;
+    }
+    else if constexpr (to == unicode_encoding::utf16)
+    {
+        return from == unicode_encoding::utf32 ? 2 : 1;
+    }
+    else
+    {
+        return 1;
+    }
+}();
+
+/**
+ * @brief Code units below this bound are copied unchanged by the vectorised fast path: ASCII when either side is
+ * UTF-8, everything below the surrogates between UTF-16 and UTF-32.
+ */
+template <typename FromChar, typename ToChar>
+inline constexpr std::uint32_t direct_bound_v = encoding_of_v<FromChar> == unicode_encoding::utf8 ||
+                                                        encoding_of_v<ToChar> == unicode_encoding::utf8
+                                                    ? 0x80U
+                                                    : 0xD800U;
+
+/**
+ * @brief Result of converting one block: the transcode_result and the number of code units written.
+ */
+struct block_result
+{
+    transcode_result result;
+    size_t           written;
+};
+
+/**
+ * @brief Widen or narrow size code units that need no conversion. Fixed-width blocks through a local buffer let the
+ * compiler vectorise the copy at -O2, where it would not for the open loop with possibly aliasing pointers.
+ */
+template <typename FromChar, typename ToChar>
+inline void copy_direct(FromChar const* in, size_t size, ToChar* out) noexcept
+{
+    constexpr size_t block_size = 32;
+    size_t           unit       = 0;
+    for (; unit + block_size <= size; unit += block_size)
+    {
+        ToChar block[block_size];
+        for (size_t index = 0; index < block_size; ++index)
+        {
+            block[index] = static_cast<ToChar>(in[unit + index]);
+        }
+        std::memcpy(out + unit, block, sizeof(block));
+    }
+    for (; unit < size; ++unit)
+    {
+        out[unit] = static_cast<ToChar>(in[unit]);
+    }
+}
+
+/**
+ * @brief Convert [in, in + size) to out, which must have room for max_expansion_v * size code units. Runs of code
+ * units below direct_bound_v are found with the vectorised prefix scan and copied; everything else is decoded and
+ * encoded one code point at a time.
+ *
+ * @param final whether the input ends here; if not, a sequence cut off at the end is reported as truncated rather
+ * than invalid
+ */
+template <typename FromChar, typename ToChar>
+block_result transcode_block(FromChar const* in, size_t size, ToChar* out, bool final) noexcept
+{
+    constexpr std::uint32_t bound = direct_bound_v<FromChar, ToChar>;
+    ToChar*                 pos   = out;
+    size_t                  index = 0;
+    while (index < size)
+    {
+        if (unit_value(in[index]) < bound)
+        {
+            // short runs between multi-unit sequences are copied right away, longer ones go to the vector kernel
+            constexpr size_t short_run = 8;
+            size_t const     rest      = size - index;
+            size_t           run       = 0;
+            while (run < rest && run < short_run && unit_value(in[index + run]) < bound)
+            {
+                pos[run] = static_cast<ToChar>(in[index + run]);
+                ++run;
+            }
+            if (run == short_run)
+            {
+                size_t const more = simd::leading_below(in + index + run, rest - run, bound);
+                copy_direct(in + index + run, more, pos + run);
+                run += more;
+            }
+            pos += run;
+            index += run;
+            continue;
+        }
+        decoded_code_point const decoded = decode_one(in + index, size - index);
+        if (decoded.status != transcode_status::ok)
+        {
+            transcode_status const status =
+                decoded.status == transcode_status::truncated && !final ? transcode_status::truncated
+                                                                        : transcode_status::invalid;
+            return {{status, index}, static_cast<size_t>(pos - out)};
+        }
+        pos += encode_one(decoded.code_point, pos);
+        index += decoded.length;
+    }
+    return {{transcode_status::ok, size}, static_cast<size_t>(pos - out)};
+}
+
+/**
+ * @brief Grow out by at most max_size code units, let write fill them and keep as many as it reports.
+ */
+template <typename CharT, typename Traits, typename Alloc, typename Write>
+void append_at_most(std::basic_string<CharT, Traits, Alloc>& out, size_t max_size, Write write)
+{
+    size_t const old_size = out.size();
+#if defined(__cpp_lib_string_resize_and_overwrite)
+    out.resize_and_overwrite(old_size + max_size,
+                             [&](CharT* buffer, size_t /* capacity */) { return old_size + write(buffer + old_size); });
+#else
+    out.resize(old_size + max_size);
+    out.resize(old_size + write(out.data() + old_size));
+#endif
+}
+} // namespace detail
+
+/**
+ * @brief Transcode a complete string-like and append the result to out. Unlike charToChar, which casts a single code
+ * unit, this converts between the Unicode encodings of the character types (see encoding_of_v), combining and
+ * splitting surrogate pairs and multi-byte UTF-8 sequences, and validates the input. Between equal encodings the input
+ * is validated and copied.
+ *
+ * @code{.cpp}
+ * std::string utf8;
+ * if (!util::transcode(u"grüß dich", utf8)) { ... }
+ * @endcode
+ *
+ * @param from std::basic_string, std::basic_string_view, character pointer or array of any character type
+ * @param out string to append the converted code units to; on error it holds the conversion of the valid prefix
+ * @return transcode_result status and, on error, the index of the first ill-formed code unit sequence
+ */
+template <typename ToChar, typename From, typename Traits, typename Alloc>
+requires is_char_v<ToChar> && is_string_v<From>
+transcode_result transcode(From const& from, std::basic_string<ToChar, Traits, Alloc>& out)
+{
+    using from_char_type = string_char_t<From>;
+    auto const       units = as_string_view(from);
+    transcode_result result;
+    detail::append_at_most(out, units.size() * detail::max_expansion_v<from_char_type, ToChar>, [&](ToChar* buffer) {
+        detail::block_result const block = detail::transcode_block(units.data(), units.size(), buffer, true);
+        result                           = block.result;
+        return block.written;
+    });
+    return result;
+}
+
+/**
+ * @brief Incremental transcoding of input arriving in chunks. A multi-unit sequence split between two chunks is kept
+ * (at most three code units) and completed by the next feed().
+ *
+ * @code{.cpp}
+ * util::transcoder<char16_t, char> utf16_to_utf8;
+ * std::string out;
+ * while (auto chunk = next_chunk())
+ *     if (!utf16_to_utf8.feed(*chunk, out)) { ... }
+ * if (!utf16_to_utf8.finish()) { ... } // input ended inside a sequence
+ * @endcode
+ *
+ * @tparam FromChar character type of the input
+ * @tparam ToChar character type of the output
+ */
+template <typename FromChar, typename ToChar>
+requires is_char_v<FromChar> && is_char_v<ToChar>
+class transcoder
+{
+    FromChar pending_[4]{};
+    size_t   pending_size_ = 0;
+
+  public:
+    /**
+     * @brief Transcode the next chunk and append the result to out.
+     *
+     * @param chunk string-like of FromChar
+     * @param out string to append the converted code units to
+     * @return transcode_result ok if the chunk was consumed (possibly keeping a split sequence), otherwise the index in
+     * the chunk of the ill-formed sequence; 0 also when it started in an earlier chunk. The transcoder is reset on
+     * error.
+     */
+    template <typename Chunk, typename Traits, typename Alloc>
+    requires std::same_as<string_char_t<Chunk>, FromChar>
+    transcode_result feed(Chunk const& chunk, std::basic_string<ToChar, Traits, Alloc>& out)
+    {
+        auto const units = as_string_view(chunk);
+        size_t     index = 0;
+        while (pending_size_ > 0)
+        {
+            detail::decoded_code_point const decoded = detail::decode_one(pending_, pending_size_);
+            if (decoded.status == transcode_status::ok)
+            {
+                detail::append_at_most(out, 4, [&](ToChar* buffer) {
+                    return detail::encode_one(decoded.code_point, buffer);
+                });
+                pending_size_ = 0;
+            }
+            else if (decoded.status == transcode_status::invalid)
+            {
+                reset();
+                return {transcode_status::invalid, 0};
+            }
+            else if (index == units.size())
+            {
+                return {transcode_status::ok, units.size()};
+            }
+            else
+            {
+                pending_[pending_size_++] = units[index++];
+            }
+        }
+
+        transcode_result result;
+        detail::append_at_most(
+            out,
+            (units.size() - index) * detail::max_expansion_v<FromChar, ToChar>,
+            [&](ToChar* buffer) {
+                detail::block_result const block =
+                    detail::transcode_block(units.data() + index, units.size() - index, buffer, false);
+                result = block.result;
+                return block.written;
+            }
+        );
+        if (result.status == transcode_status::truncated)
+        {
+            for (size_t unit = index + result.position; unit < units.size(); ++unit)
+            {
+                pending_[pending_size_++] = units[unit];
+            }
+            return {transcode_status::ok, units.size()};
+        }
+        if (result.status == transcode_status::invalid)
+        {
+            reset();
+            return {transcode_status::invalid, index + result.position};
+        }
+        return {transcode_status::ok, units.size()};
+    }
+
+    /**
+     * @brief End of input: a sequence still waiting for its remaining code units is reported as truncated.
+     */
+    transcode_result finish() noexcept
+    {
+        bool const truncated = pending_size_ > 0;
+        reset();
+        return {truncated ? transcode_status::truncated : transcode_status::ok, 0};
+    }
+
+    /**
+     * @brief Number of code units of a split sequence kept for the next feed().
+     */
+    [[nodiscard]] size_t pending() const noexcept
+    {
+        return pending_size_;
+    }
+
+    void reset() noexcept
+    {
+        pending_size_ = 0;
+    }
+};
+
+} // namespace util
+
+#endif // TRANSCODE_H_INCLUDED
@@ -0,0 +1,144 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/tuple_algorithms.h
+ * Description: for_each, transform and fold over the elements of tuple-like types, expanded without recursion.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef TUPLE_ALGORITHMS_H_INCLUDED
+#define TUPLE_ALGORITHMS_H_INCLUDED
+
+#include "traits.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+namespace detail
+{
+template <size_t I, typename Tuple>
+concept has_member_get = requires(Tuple&& tuple) { std::forward<Tuple>(tuple).template get<I>(); };
+
+/**
+ * @brief The I-th element of a tuple-like, looked up like a structured binding does: member get<I>() first, then
+ * get<I>() found by argument-dependent lookup or in namespace std.
+ */
+template <size_t I, typename Tuple> constexpr decltype(auto) tuple_get(Tuple&& tuple)
+{
+    if constexpr (has_member_get<I, Tuple>)
+    {
+        return std::forward<Tuple>(tuple).template get<I>();
+    }
+    else
+    {
+        using std::get;
+        return get<I>(std::forward<Tuple>(tuple));
+    }
+}
+
+template <typename Tuple>
+using tuple_indices_t = std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Tuple>>>;
+
+/**
+ * @brief Accumulator of tuple_fold. Folding with operator| over the pack of elements yields the left fold
+ * fold(...fold(fold(init, e0), e1)..., en) as one expression, so the accumulated type may change from element to
+ * element.
+ */
+template <typename F, typename Acc> struct fold_accumulator
+{
+    F&  fold;
+    Acc value;
+};
+
+template <typename F, typename Acc, typename Element>
+constexpr auto operator|(fold_accumulator<F, Acc>&& accumulator, Element&& element)
+{
+    using result_type = std::invoke_result_t<F&, Acc&&, Element&&>;
+    return fold_accumulator<F, result_type>{
+        accumulator.fold, accumulator.fold(std::move(accumulator.value), std::forward<Element>(element))};
+}
+} // namespace detail
+
+/**
+ * @brief Call func with each element of a tuple-like in order. The calls are expanded into straight-line code.
+ *
+ * @code{.cpp}
+ * util::tuple_for_each(std::pair{1, "one"}, [](auto const& element) { std::cout << element; });
+ * @endcode
+ */
+template <typename Tuple, typename F>
+requires is_tuple_like_c<Tuple>
+constexpr void tuple_for_each(Tuple&& tuple, F&& func)
+{
+    [&]<size_t... Is>(std::index_sequence<Is...>)
+    {
+        (static_cast<void>(func(detail::tuple_get<Is>(std::forward<Tuple>(tuple)))), ...);
+    }(detail::tuple_indices_t<Tuple>{});
+}
+
+/**
+ * @brief std::tuple of the results of func applied to each element of a tuple-like, called in order. Results are stored
+ * as returned, so a function returning references yields a tuple of references.
+ *
+ * @code{.cpp}
+ * auto sizes = util::tuple_transform(std::pair{std::string("ab"), std::vector<int>(3)},
+ *                                    [](auto const& range) { return range.size(); }); // std::tuple{2, 3}
+ * @endcode
+ */
+template <typename Tuple, typename F>
+requires is_tuple_like_c<Tuple>
+constexpr auto tuple_transform(Tuple&& tuple, F&& func)
+{
+    return [&]<size_t... Is>(std::index_sequence<Is...>)
+    {
+        // braced initialisation evaluates the calls left to right
+        return std::tuple<decltype(func(detail::tuple_get<Is>(std::forward<Tuple>(tuple))))...>{
+            func(detail::tuple_get<Is>(std::forward<Tuple>(tuple)))...};
+    }(detail::tuple_indices_t<Tuple>{});
+}
+
+/**
+ * @brief Left fold of the elements of a tuple-like: func(...func(func(init, e0), e1)..., en). The accumulator may
+ * change type from step to step.
+ *
+ * @code{.cpp}
+ * auto total = util::tuple_fold(std::tuple{1, 2.5, 3L}, 0.0, [](auto acc, auto element) { return acc + element; });
+ * @endcode
+ */
+template <typename Tuple, typename Init, typename F>
+requires is_tuple_like_c<Tuple>
+constexpr auto tuple_fold(Tuple&& tuple, Init init, F&& func)
+{
+    return [&]<size_t... Is>(std::index_sequence<Is...>)
+    {
+        using start_type = detail::fold_accumulator<F, Init>;
+        return (start_type{func, std::move(init)} | ... | detail::tuple_get<Is>(std::forward<Tuple>(tuple)))
+            .value;
+    }(detail::tuple_indices_t<Tuple>{});
+}
+
+} // namespace util
+
+#endif // TUPLE_ALGORITHMS_H_INCLUDED
@@ -0,0 +1,142 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/tuple_hash.h
+ * Description: Structural hash of tuples and pairs from the hashes of their elements, and util::hash, which extends
+ *              std::hash to them.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef TUPLE_HASH_H_INCLUDED
+#define TUPLE_HASH_H_INCLUDED
+
+#include "bitwise.h"
+#include "traits.h"
+#include "tuple_algorithms.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+/**
+ * @brief Hasher of T: std::hash<T>, extended to tuples and pairs whose elements it can hash (see tuple_hash), nested
+ * ones included. Where neither applies it has no call operator, so that has_std_hash_v<T, util::hash<T>> is false.
+ *
+ * @code{.cpp}
+ * std::unordered_map<std::tuple<std::string, int, int>, Route, util::hash<std::tuple<std::string, int, int>>> routes;
+ * @endcode
+ */
+template <typename T> struct hash : std::hash<T>
+{
+};
+
+namespace detail
+{
+template <typename T> struct is_std_pair : std::false_type
+{
+};
+
+template <typename First, typename Second> struct is_std_pair<std::pair<First, Second>> : std::true_type
+{
+};
+
+template <typename Tuple, typename Indices = tuple_indices_t<Tuple>> struct elements_hashable;
+
+template <typename Tuple, size_t... Is>
+struct elements_hashable<Tuple, std::index_sequence<Is...>>
+    : std::bool_constant<(has_std_hash_v<std::remove_cvref_t<std::tuple_element_t<Is, Tuple>>,
+                                         util::hash<std::remove_cvref_t<std::tuple_element_t<Is, Tuple>>>> &&
+                          ...)>
+{
+};
+
+template <typename Tuple, typename Indices = tuple_indices_t<Tuple>> struct elements_nothrow_hashable;
+
+template <typename Tuple, size_t... Is>
+struct elements_nothrow_hashable<Tuple, std::index_sequence<Is...>>
+    : std::bool_constant<(std::is_nothrow_invocable_v<util::hash<std::remove_cvref_t<std::tuple_element_t<Is, Tuple>>>,
+                                                      std::tuple_element_t<Is, Tuple> const&> &&
+                          ...)>
+{
+};
+
+/**
+ * @brief Hash of the I-th element of a tuple or pair, with util::hash of its type.
+ */
+template <size_t I, typename Tuple> size_t element_hash(Tuple const& tuple)
+{
+    using element_type = std::remove_cvref_t<std::tuple_element_t<I, Tuple>>;
+    return util::hash<element_type>{}(tuple_get<I>(tuple));
+}
+} // namespace detail
+
+/**
+ * @brief Concept of the tuples (see is_tuple) and std::pairs that tuple_hash can hash: those whose element types all
+ * have a hash, either std::hash or util::hash for nested tuples and pairs.
+ */
+template <typename T>
+concept tuple_hashable_c = (is_tuple_v<T> || detail::is_std_pair<T>::value) && detail::elements_hashable<T>::value;
+
+/**
+ * @brief Hash of a tuple or pair from the hashes of its elements. Each element hash is folded into a running state with
+ * a 64x64->128-bit multiply of which both halves are kept (as wyhash mixes, see bitwise.h), so that every bit of the
+ * result depends on every bit of every element hash, including the identity hashes std::hash has for integers, for
+ * which the shift-and-add hash_combine of boost lets different tuples collide outright. The fold is expanded at
+ * compile time into straight-line code without branches.
+ *
+ * @code{.cpp}
+ * using Key = std::tuple<std::string, int, int>;
+ * std::unordered_map<Key, Route, util::tuple_hash<Key>> routes;
+ * routes[{"eth0", 10, 24}] = route;
+ * @endcode
+ */
+template <typename T>
+requires tuple_hashable_c<T>
+struct tuple_hash
+{
+    size_t operator()(T const& value) const noexcept(detail::elements_nothrow_hashable<T>::value)
+    {
+        return [&]<size_t... Is>(std::index_sequence<Is...>)
+        {
+            uint64_t state = detail::hash_secret[0] ^ sizeof...(Is);
+            ((state = detail::mix_wide(state ^ detail::element_hash<Is>(value), detail::hash_secret[1])), ...);
+            return static_cast<size_t>(state);
+        }(detail::tuple_indices_t<T>{});
+    }
+};
+
+/**
+ * @brief Tuples and pairs of hashable elements are hashed by tuple_hash.
+ */
+template <typename T>
+requires tuple_hashable_c<T>
+struct hash<T> : tuple_hash<T>
+{
+};
+
+} // namespace util
+
+#endif // TUPLE_HASH_H_INCLUDED
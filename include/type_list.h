@@ -0,0 +1,409 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/type_list.h
+ * Description: Type lists and algorithms on them with constant template instantiation depth.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef TYPE_LIST_H_INCLUDED
+#define TYPE_LIST_H_INCLUDED
+
+#include "traits.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Identity of a type that can be compared in constant expressions: every type has its own tag object.
+ */
+template <typename T> struct type_tag
+{
+    static constexpr char id = 0;
+};
+
+/**
+ * @brief Tag addresses of the types of a pack, followed by nullptr; instantiated once per pack.
+ */
+template <typename... Ts> inline constexpr char const* tag_ids[] = {&type_tag<Ts>::id..., nullptr};
+
+/**
+ * @brief Position of the first occurrence of id in ids, or the number of ids before the terminating nullptr.
+ */
+template <size_t N> constexpr size_t find_tag(char const* const (&ids)[N], char const* id)
+{
+    size_t index = 0;
+    while (index < N - 1 && ids[index] != id)
+    {
+        ++index;
+    }
+    return index;
+}
+} // namespace detail
+
+/**
+ * @brief Compile-time list of types. None of the algorithms below recurse over the elements: they expand packs with
+ * fold expressions, compute positions in constexpr functions and pick the selected elements with get_Nth_type, so the
+ * template instantiation depth stays constant however long the list is.
+ *
+ * @code{.cpp}
+ * using messages = util::type_list<Login, Logout, Ping>;
+ * static_assert(messages::size == 3);
+ * static_assert(messages::index_of<Ping> == 2);
+ * using variant  = messages::apply<std::variant>; // std::variant<Login, Logout, Ping>
+ * @endcode
+ */
+template <typename... Ts> struct type_list
+{
+    static constexpr size_t size = sizeof...(Ts);
+
+    template <size_t N> using at = get_Nth_type_t<N, Ts...>;
+
+    // size if T is not in the list; a linear search in the constant evaluator, with no instantiation per element
+    template <typename T>
+    static constexpr size_t index_of = detail::find_tag(detail::tag_ids<Ts...>, &detail::type_tag<T>::id);
+
+    template <typename T> static constexpr bool contains = index_of<T> != size;
+
+    template <template <typename...> class Template> using apply = Template<Ts...>;
+};
+
+template <typename> struct is_type_list : std::false_type
+{
+};
+
+template <typename... Ts> struct is_type_list<type_list<Ts...>> : std::true_type
+{
+};
+
+template <typename T> using is_type_list_t = typename is_type_list<T>::type;
+
+template <typename T> bool constexpr is_type_list_v = is_type_list<T>::value;
+
+/**
+ * @brief Type list of the element types of a std::tuple.
+ */
+template <typename Tuple>
+requires is_tuple_v<Tuple>
+struct type_list_from_tuple;
+
+template <typename... Ts> struct type_list_from_tuple<std::tuple<Ts...>>
+{
+    using type = type_list<Ts...>;
+};
+
+template <typename Tuple> using type_list_from_tuple_t = typename type_list_from_tuple<Tuple>::type;
+
+/**
+ * @brief True if T is an element of List.
+ */
+template <typename List, typename T>
+requires is_type_list_v<List>
+struct type_list_contains : std::bool_constant<List::template contains<T>>
+{
+};
+
+template <typename List, typename T> bool constexpr type_list_contains_v = type_list_contains<List, T>::value;
+
+/**
+ * @brief Zero-based index of the first T in List, List::size if T is not an element.
+ */
+template <typename List, typename T>
+requires is_type_list_v<List>
+struct type_list_index_of : std::integral_constant<size_t, List::template index_of<T>>
+{
+};
+
+template <typename List, typename T> constexpr size_t type_list_index_of_v = type_list_index_of<List, T>::value;
+
+namespace detail
+{
+template <typename... Ts> struct concat_accumulator
+{
+};
+
+// declared only: concatenation is evaluated in decltype
+template <typename... As, typename... Bs>
+concat_accumulator<As..., Bs...> operator+(concat_accumulator<As...>, type_list<Bs...>);
+
+template <typename Accumulator> struct concat_result;
+
+template <typename... Ts> struct concat_result<concat_accumulator<Ts...>>
+{
+    using type = type_list<Ts...>;
+};
+
+/**
+ * @brief Positions of the true entries of keep, in order.
+ */
+template <size_t Count, size_t N> constexpr std::array<size_t, Count> positions_of(std::array<bool, N> const& keep)
+{
+    std::array<size_t, Count> positions{};
+    size_t                    next = 0;
+    for (size_t index = 0; index < N; ++index)
+    {
+        if (keep[index])
+        {
+            positions[next++] = index;
+        }
+    }
+    return positions;
+}
+
+template <size_t N> constexpr size_t count_of(std::array<bool, N> const& keep)
+{
+    size_t count = 0;
+    for (bool const kept : keep)
+    {
+        count += kept ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Positions of the elements of a pack for which Pred<T>::value holds.
+ */
+template <template <typename> class Pred, typename... Ts> struct filter_positions
+{
+    static constexpr std::array<bool, sizeof...(Ts)> keep{static_cast<bool>(Pred<Ts>::value)...};
+    static constexpr auto                            value = positions_of<count_of(keep)>(keep);
+};
+
+/**
+ * @brief Positions of the first occurrences of the types of a pack: each type's tag address is searched for from the
+ * front of the pack, in the constant evaluator. Quadratic in evaluation steps, but with one instantiation per type this
+ * is far cheaper than any comparison of types for lists up to unique_search_limit elements.
+ */
+template <typename... Ts> struct unique_positions
+{
+    static constexpr std::array<bool, sizeof...(Ts)> keep = []
+    {
+        constexpr char const*           ids[] = {&type_tag<Ts>::id..., nullptr};
+        std::array<bool, sizeof...(Ts)> first{};
+        for (size_t index = 0; index < sizeof...(Ts); ++index)
+        {
+            size_t earliest = 0;
+            while (ids[earliest] != ids[index])
+            {
+                ++earliest;
+            }
+            first[index] = earliest == index;
+        }
+        return first;
+    }();
+    static constexpr auto value = positions_of<count_of(keep)>(keep);
+};
+
+/**
+ * @brief Longer lists would exceed the default operation limit of GCC's constant evaluator in unique_positions.
+ */
+inline constexpr size_t unique_search_limit = 1024;
+
+/**
+ * @brief Set of distinct types for membership tests with std::is_base_of.
+ */
+template <typename... Ts> struct type_set : type_tag<Ts>...
+{
+};
+
+/**
+ * @brief Accumulator of type_list_unique for long lists: the distinct types seen so far, in order.
+ */
+template <typename... Ts> struct unique_accumulator
+{
+};
+
+// declared only: evaluated in decltype; appends T unless it is already in the set of the types seen so far
+template <typename... Ts, typename T>
+auto operator+(unique_accumulator<Ts...>, type_tag<T>)
+    -> std::conditional_t<std::is_base_of_v<type_tag<T>, type_set<Ts...>>, unique_accumulator<Ts...>,
+                          unique_accumulator<Ts..., T>>;
+
+template <typename Accumulator> struct unique_result;
+
+template <typename... Ts> struct unique_result<unique_accumulator<Ts...>>
+{
+    using type = type_list<Ts...>;
+};
+
+/**
+ * @brief Positions of the elements of a pack stably ordered by Compare on Key<T>::value: a bottom-up merge sort of the
+ * positions in the constant evaluator, O(n log n) comparisons.
+ */
+template <template <typename> class Key, typename Compare, typename... Ts> struct sort_positions
+{
+    static constexpr std::array<size_t, sizeof...(Ts)> value = []
+    {
+        constexpr size_t      n = sizeof...(Ts);
+        std::array<size_t, n> order{};
+        if constexpr (n > 0)
+        {
+            constexpr auto        keys = std::array{Key<Ts>::value...};
+            constexpr Compare     compare{};
+            std::array<size_t, n> merged{};
+            for (size_t index = 0; index < n; ++index)
+            {
+                order[index] = index;
+            }
+            for (size_t width = 1; width < n; width *= 2)
+            {
+                for (size_t left = 0; left < n; left += 2 * width)
+                {
+                    size_t const middle = std::min(left + width, n);
+                    size_t const right  = std::min(left + 2 * width, n);
+                    size_t       lhs    = left;
+                    size_t       rhs    = middle;
+                    for (size_t out = left; out < right; ++out)
+                    {
+                        // take from the right run only if strictly less: equal keys keep their order
+                        if (rhs < right && (lhs == middle || compare(keys[order[rhs]], keys[order[lhs]])))
+                        {
+                            merged[out] = order[rhs++];
+                        }
+                        else
+                        {
+                            merged[out] = order[lhs++];
+                        }
+                    }
+                }
+                order = merged;
+            }
+        }
+        return order;
+    }();
+};
+
+/**
+ * @brief Type list of the elements of List at Positions::value, in that order.
+ */
+template <typename Positions, typename List, typename = std::make_index_sequence<Positions::value.size()>>
+struct pick_positions;
+
+template <typename Positions, typename... Ts, size_t... Is>
+struct pick_positions<Positions, type_list<Ts...>, std::index_sequence<Is...>>
+{
+    using type = type_list<get_Nth_type_t<Positions::value[Is], Ts...>...>;
+};
+} // namespace detail
+
+/**
+ * @brief Concatenation of any number of type lists.
+ */
+template <typename... Lists>
+requires(is_type_list_v<Lists> && ...)
+struct type_list_concat
+    : detail::concat_result<decltype((detail::concat_accumulator<>{} + ... + Lists{}))>
+{
+};
+
+template <typename... Lists> using type_list_concat_t = typename type_list_concat<Lists...>::type;
+
+/**
+ * @brief List of Fn<T> for every element T, for an alias template Fn such as std::add_pointer_t.
+ */
+template <typename List, template <typename> class Fn> struct type_list_transform;
+
+template <typename... Ts, template <typename> class Fn> struct type_list_transform<type_list<Ts...>, Fn>
+{
+    using type = type_list<Fn<Ts>...>;
+};
+
+template <typename List, template <typename> class Fn>
+using type_list_transform_t = typename type_list_transform<List, Fn>::type;
+
+/**
+ * @brief List of the elements T for which Pred<T>::value holds, in order; Pred is a trait such as std::is_integral.
+ */
+template <typename List, template <typename> class Pred> struct type_list_filter;
+
+template <typename... Ts, template <typename> class Pred> struct type_list_filter<type_list<Ts...>, Pred>
+    : detail::pick_positions<detail::filter_positions<Pred, Ts...>, type_list<Ts...>>
+{
+};
+
+template <typename List, template <typename> class Pred>
+using type_list_filter_t = typename type_list_filter<List, Pred>::type;
+
+/**
+ * @brief List without repeated elements, keeping the first occurrence of each.
+ */
+template <typename List> struct type_list_unique;
+
+template <typename... Ts>
+requires(sizeof...(Ts) <= detail::unique_search_limit)
+struct type_list_unique<type_list<Ts...>> : detail::pick_positions<detail::unique_positions<Ts...>, type_list<Ts...>>
+{
+};
+
+template <typename... Ts>
+requires(sizeof...(Ts) > detail::unique_search_limit)
+struct type_list_unique<type_list<Ts...>>
+    : detail::unique_result<decltype((detail::unique_accumulator<>{} + ... + detail::type_tag<Ts>{}))>
+{
+};
+
+template <typename List> using type_list_unique_t = typename type_list_unique<List>::type;
+
+/**
+ * @brief Key for type_list_sort_by: the size of T.
+ */
+template <typename T> struct size_of : std::integral_constant<size_t, sizeof(T)>
+{
+};
+
+/**
+ * @brief Key for type_list_sort_by: the alignment of T.
+ */
+template <typename T> struct align_of : std::integral_constant<size_t, alignof(T)>
+{
+};
+
+/**
+ * @brief List stably sorted by Key<T>::value, ascending by default; e.g. by descending alignment to minimise padding:
+ *
+ * @code{.cpp}
+ * using packed = util::type_list_sort_by_t<util::type_list<char, double, int>, util::align_of, std::greater<>>;
+ * // util::type_list<double, int, char>
+ * @endcode
+ */
+template <typename List, template <typename> class Key, typename Compare = std::less<>> struct type_list_sort_by;
+
+template <typename... Ts, template <typename> class Key, typename Compare>
+struct type_list_sort_by<type_list<Ts...>, Key, Compare>
+    : detail::pick_positions<detail::sort_positions<Key, Compare, Ts...>, type_list<Ts...>>
+{
+};
+
+template <typename List, template <typename> class Key, typename Compare = std::less<>>
+using type_list_sort_by_t = typename type_list_sort_by<List, Key, Compare>::type;
+
+} // namespace util
+
+#endif // TYPE_LIST_H_INCLUDED
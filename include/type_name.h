@@ -0,0 +1,161 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/type_name.h
+ * Description: Names and stable 64-bit identities of types at compile time, without RTTI.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef TYPE_NAME_H_INCLUDED
+#define TYPE_NAME_H_INCLUDED
+
+#include "string_hash.h"
+#include "traits.h"
+#include "type_list.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Signature of this function as spelled by the compiler, which contains the name of T. The return type is
+ * deduced, or GCC would spell out the alias std::string_view after T.
+ */
+template <typename T> constexpr auto type_signature() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return std::string_view{__FUNCSIG__};
+#else
+    return std::string_view{__PRETTY_FUNCTION__};
+#endif
+}
+
+/**
+ * @brief Length of the text before and after the name of T in type_signature<T>(), found from the signature for int.
+ */
+struct type_signature_affixes
+{
+    static constexpr std::string_view probe  = type_signature<int>();
+    static constexpr size_t           prefix = probe.rfind("int");
+    static constexpr size_t           suffix = probe.size() - prefix - (sizeof("int") - 1);
+};
+
+/**
+ * @brief Copy of the name of T that outlives constant evaluation.
+ */
+template <typename T> struct type_name_storage
+{
+    static constexpr auto chars = []
+    {
+        constexpr std::string_view signature = type_signature<T>();
+        constexpr std::string_view name      = signature.substr(
+            type_signature_affixes::prefix,
+            signature.size() - type_signature_affixes::prefix - type_signature_affixes::suffix
+        );
+        std::array<char, name.size() + 1> copy{};
+        for (size_t index = 0; index < name.size(); ++index)
+        {
+            copy[index] = name[index];
+        }
+        return copy;
+    }();
+
+    static constexpr std::string_view value{chars.data(), chars.size() - 1};
+};
+} // namespace detail
+
+/**
+ * @brief Name of T as spelled by the compiler, e.g. "std::vector<int>" or "const Foo&", without typeid. The spelling
+ * differs between compilers (MSVC writes "class Foo"), so it is meant for diagnostics and for type_id, not for parsing.
+ *
+ * @code{.cpp}
+ * static_assert(util::type_name<int>() == "int");
+ * @endcode
+ */
+template <typename T> constexpr std::string_view type_name() noexcept
+{
+    return detail::type_name_storage<T>::value;
+}
+
+/**
+ * @brief Stable 64-bit identity of T: the FNV-1a hash of its name, so equal in every translation unit and every run of
+ * a program built by the same compiler, and usable as a constant key of type-erased registries in builds without RTTI.
+ * Distinct types with internal linkage but the same name in different translation units share an id; within a set of
+ * types has_distinct_type_ids checks for collisions.
+ *
+ * @code{.cpp}
+ * std::unordered_map<std::uint64_t, handler> handlers;
+ * handlers[util::type_id<Login>()] = on_login;
+ * @endcode
+ */
+template <typename T> constexpr uint64_t type_id() noexcept
+{
+    return detail::fnv1a(type_name<T>());
+}
+
+template <typename T> inline constexpr uint64_t type_id_v = type_id<T>();
+
+/**
+ * @brief Identities of the types of a pack, in order: type_ids_v<Ts...>[N] == type_id_v<get_Nth_type_t<N, Ts...>>.
+ */
+template <typename... Ts> inline constexpr std::array<uint64_t, sizeof...(Ts)> type_ids_v{type_id<Ts>()...};
+
+/**
+ * @brief True if the distinct types of a type list have distinct type ids; sorts the ids, so O(n log n) for long
+ * lists.
+ *
+ * @code{.cpp}
+ * static_assert(util::has_distinct_type_ids_v<util::type_list<Login, Logout, Ping>>);
+ * @endcode
+ */
+template <typename List>
+requires is_type_list_v<List>
+struct has_distinct_type_ids;
+
+template <typename... Ts> struct has_distinct_type_ids<type_list<Ts...>>
+{
+  private:
+    template <typename... Us> static constexpr bool distinct(type_list<Us...>)
+    {
+        std::array<uint64_t, sizeof...(Us)> ids{type_id<Us>()...};
+        std::sort(ids.begin(), ids.end());
+        return std::adjacent_find(ids.begin(), ids.end()) == ids.end();
+    }
+
+  public:
+    static constexpr bool value = distinct(type_list_unique_t<type_list<Ts...>>{});
+    using type                  = std::bool_constant<value>;
+};
+
+template <typename List> using has_distinct_type_ids_t = typename has_distinct_type_ids<List>::type;
+
+template <typename List> inline constexpr bool has_distinct_type_ids_v = has_distinct_type_ids<List>::value;
+
+} // namespace util
+
+#endif // TYPE_NAME_H_INCLUDED
@@ -0,0 +1,331 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   include/visit.h
+ * Description: Indexed visitation of std::variant through one flat table of all combinations of alternatives.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef VISIT_H_INCLUDED
+#define VISIT_H_INCLUDED
+
+#include "traits.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// The switch of util::visit_indexed is forced inline, so that the visitor bodies become the cases of one jump table in
+// the caller; compilers decline to inline large switches called from more than one place. Undefined at the end.
+#if defined(__GNUC__) || defined(__clang__)
+    #define VISIT_ALWAYS_INLINE __attribute__((always_inline)) inline
+#elif defined(_MSC_VER)
+    #define VISIT_ALWAYS_INLINE __forceinline
+#else
+    #define VISIT_ALWAYS_INLINE inline
+#endif
+
+namespace util
+{
+
+namespace detail
+{
+/**
+ * @brief Alternatives of a std::variant, selected with get_Nth_type.
+ */
+template <typename Variant> struct variant_alternatives;
+
+template <typename... Ts> struct variant_alternatives<std::variant<Ts...>>
+{
+    static constexpr size_t size = sizeof...(Ts);
+
+    template <size_t I> using type = get_Nth_type_t<I, Ts...>;
+};
+
+template <typename Variant>
+concept is_std_variant_c = requires { variant_alternatives<std::remove_cvref_t<Variant>>::size; };
+
+/**
+ * @brief Alternative I of a variant with the constness and value category of the variant, as std::get returns it.
+ */
+template <typename Variant, size_t I> struct alternative_ref
+{
+    using alternative_type = typename variant_alternatives<std::remove_cvref_t<Variant>>::template type<I>;
+    using qualified_type   = std::conditional_t<std::is_const_v<std::remove_reference_t<Variant>>,
+                                                alternative_type const,
+                                                alternative_type>;
+    using type = std::conditional_t<std::is_lvalue_reference_v<Variant>, qualified_type&, qualified_type&&>;
+};
+
+template <typename Variant, size_t I> using alternative_ref_t = typename alternative_ref<Variant, I>::type;
+
+/**
+ * @brief Alternative I of a variant known to hold it. get_if returns null only for other alternatives, and marking that
+ * unreachable tells the optimiser so: unlike std::get this leaves no check of the index behind. (Only dereferencing the
+ * null pointer would not: GCC turns that into a trap, and keeps the check.)
+ */
+template <size_t I, typename Variant>
+constexpr alternative_ref_t<Variant&&, I> get_unchecked(Variant&& variant) noexcept
+{
+    auto* const alternative = std::get_if<I>(std::addressof(variant));
+    if (alternative == nullptr)
+    {
+        std::unreachable();
+    }
+    return static_cast<alternative_ref_t<Variant&&, I>>(*alternative);
+}
+
+template <typename Visitor, typename Indices, typename... Variants> struct visit_result;
+
+template <typename Visitor, size_t... Is, typename... Variants>
+struct visit_result<Visitor, std::index_sequence<Is...>, Variants...>
+    : std::invoke_result<Visitor, std::integral_constant<size_t, Is>..., alternative_ref_t<Variants, Is>...>
+{
+};
+
+/**
+ * @brief Call of the visitor for one combination of alternatives, Is. All combinations must have the same result
+ * type R, as for std::visit.
+ */
+template <typename R, typename Visitor, typename Indices, typename... Variants> struct visit_alternatives;
+
+template <typename R, typename Visitor, size_t... Is, typename... Variants>
+struct visit_alternatives<R, Visitor, std::index_sequence<Is...>, Variants...>
+{
+    using result_type = typename visit_result<Visitor, std::index_sequence<Is...>, Variants...>::type;
+
+    static_assert(std::is_same_v<R, result_type>,
+                  "util::visit_indexed requires the same result type for all alternatives");
+
+    VISIT_ALWAYS_INLINE static constexpr R call(Visitor&& visitor, Variants&&... variants)
+    {
+        return std::invoke(std::forward<Visitor>(visitor),
+                           std::integral_constant<size_t, Is>{}...,
+                           get_unchecked<Is>(std::forward<Variants>(variants))...);
+    }
+};
+
+/**
+ * @brief All combinations of alternatives of the variants, numbered in mixed radix: the combination of alternatives
+ * i_0, ..., i_k-1 is at ((i_0 * n_1 + i_1) * n_2 + ...) + i_k-1. The call for each combination is instantiated directly
+ * from its position, with no recursion over the variants, so the template depth is constant however many variants are
+ * visited; the number of calls, the product of the numbers of alternatives, is what any visitation instantiates.
+ */
+template <typename R, typename Visitor, typename... Variants> struct visit_table
+{
+    static constexpr size_t variant_count = sizeof...(Variants);
+
+    static constexpr std::array<size_t, variant_count> sizes{
+        variant_alternatives<std::remove_cvref_t<Variants>>::size...};
+
+    static constexpr size_t combinations =
+        (size_t{1} * ... * variant_alternatives<std::remove_cvref_t<Variants>>::size);
+
+    // up to this many combinations are dispatched by a switch, more by a table of function pointers: past it the
+    // single indirect call of the table is faster than the jump into a large switch (bench/runtime/visit_bench.cc)
+    static constexpr size_t switch_width = 16;
+
+    static constexpr size_t position(Variants const&... variants) noexcept
+    {
+        size_t flat = 0;
+        ((flat = flat * variant_alternatives<std::remove_cvref_t<Variants>>::size + variants.index()), ...);
+        return flat;
+    }
+
+    // alternative of the given variant in the combination at position flat
+    static constexpr size_t digit(size_t flat, size_t variant)
+    {
+        for (size_t later = variant + 1; later < variant_count; ++later)
+        {
+            flat /= sizes[later];
+        }
+        return flat % sizes[variant];
+    }
+
+    // alternatives of all variants in the combination at position Flat
+    template <size_t Flat, size_t... Ks> static constexpr auto digits(std::index_sequence<Ks...>)
+    {
+        return std::index_sequence<digit(Flat, Ks)...>{};
+    }
+
+    template <size_t Flat>
+    using call_type =
+        visit_alternatives<R, Visitor, decltype(digits<Flat>(std::index_sequence_for<Variants...>{})), Variants...>;
+
+    using entry_type = R (*)(Visitor&&, Variants&&...);
+
+    // called for a valueless variant
+    [[noreturn]] static R valueless(Visitor&&, Variants&&...)
+    {
+        throw std::bad_variant_access{};
+    }
+
+    // The table has a slot for every combination of index() + 1 of the variants, numbered in the mixed radix of
+    // n_k + 1. The std::variant_npos of a valueless variant wraps around to the digit 0, whose slots throw, so that the
+    // slot is computed without checking for valueless variants first.
+    static constexpr size_t slots = (size_t{1} * ... * (variant_alternatives<std::remove_cvref_t<Variants>>::size + 1));
+
+    static constexpr size_t slot(Variants const&... variants) noexcept
+    {
+        size_t flat = 0;
+        ((flat = flat * (variant_alternatives<std::remove_cvref_t<Variants>>::size + 1) + (variants.index() + 1)), ...);
+        return flat;
+    }
+
+    // index() + 1 of the given variant in the slot flat
+    static constexpr size_t slot_digit(size_t flat, size_t variant)
+    {
+        for (size_t later = variant + 1; later < variant_count; ++later)
+        {
+            flat /= sizes[later] + 1;
+        }
+        return flat % (sizes[variant] + 1);
+    }
+
+    template <size_t Slot, size_t... Ks> static constexpr entry_type slot_entry(std::index_sequence<Ks...>)
+    {
+        if constexpr (((slot_digit(Slot, Ks) == 0) || ...))
+        {
+            return &valueless;
+        }
+        else
+        {
+            using call_type =
+                visit_alternatives<R, Visitor, std::index_sequence<(slot_digit(Slot, Ks) - 1)...>, Variants...>;
+            return &call_type::call;
+        }
+    }
+
+    static constexpr std::array<entry_type, slots> entries = []<size_t... Slots>(std::index_sequence<Slots...>)
+    {
+        return std::array<entry_type, slots>{slot_entry<Slots>(std::index_sequence_for<Variants...>{})...};
+    }(std::make_index_sequence<slots>{});
+
+#define VISIT_CASE(K)                                                                                                  \
+    case K:                                                                                                            \
+        if constexpr ((K) < combinations)                                                                              \
+        {                                                                                                              \
+            return call_type<K>::call(std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);            \
+        }                                                                                                              \
+        else                                                                                                           \
+        {                                                                                                              \
+            std::unreachable();                                                                                        \
+        }
+#define VISIT_CASES_8(K)                                                                                               \
+    VISIT_CASE(K)                                                                                                      \
+    VISIT_CASE(K + 1)                                                                                                  \
+    VISIT_CASE(K + 2)                                                                                                  \
+    VISIT_CASE(K + 3)                                                                                                  \
+    VISIT_CASE(K + 4)                                                                                                  \
+    VISIT_CASE(K + 5)                                                                                                  \
+    VISIT_CASE(K + 6)                                                                                                  \
+    VISIT_CASE(K + 7)
+
+    /**
+     * @brief Call for the combination at position flat by a switch, which the compiler turns into a single jump table
+     * with the visitor inlined into the cases; the cases past the last combination are unreachable and cost nothing.
+     * A position past the cases - the std::variant_npos of a single valueless variant - throws std::bad_variant_access.
+     */
+    VISIT_ALWAYS_INLINE static constexpr R dispatch(size_t flat, Visitor&& visitor, Variants&&... variants)
+    {
+        static_assert(combinations <= switch_width);
+        switch (flat)
+        {
+            VISIT_CASES_8(0)
+            VISIT_CASES_8(8)
+            default:
+                throw std::bad_variant_access{};
+        }
+    }
+
+#undef VISIT_CASES_8
+#undef VISIT_CASE
+};
+
+template <typename R, typename Visitor, typename... Variants>
+VISIT_ALWAYS_INLINE constexpr R visit_combination(Visitor&& visitor, Variants&&... variants)
+{
+    using table_type = visit_table<R, Visitor, Variants...>;
+    if constexpr (table_type::combinations <= table_type::switch_width)
+    {
+        size_t flat = 0;
+        if constexpr (table_type::variant_count == 1)
+        {
+            // the index is the position; valueless is std::variant_npos, which no combination has
+            flat = (variants.index(), ...);
+        }
+        else
+        {
+            if ((variants.valueless_by_exception() || ...))
+            {
+                throw std::bad_variant_access{};
+            }
+            flat = table_type::position(variants...);
+        }
+        return table_type::dispatch(flat, std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);
+    }
+    else
+    {
+        return table_type::entries[table_type::slot(variants...)](std::forward<Visitor>(visitor),
+                                                                  std::forward<Variants>(variants)...);
+    }
+}
+
+// index of the first alternative, for each of the variants
+template <typename Variant> inline constexpr size_t first_alternative = 0;
+
+/**
+ * @brief Result of visiting the first alternatives of all variants, which the other combinations must match.
+ */
+template <typename Visitor, typename... Variants>
+using first_visit_result_t =
+    typename visit_result<Visitor, std::index_sequence<first_alternative<Variants>...>, Variants...>::type;
+} // namespace detail
+
+/**
+ * @brief Call visitor with the indices of the alternatives held by variants, as std::integral_constant<size_t, I>,
+ * followed by the alternatives themselves, so that the visitor can tell apart alternatives of the same type and use
+ * the indices in constant expressions. All combinations of alternatives are dispatched by one jump: a switch with the
+ * visitor inlined for up to 16 combinations, a flat table of function pointers built at compile time for more. The
+ * template depth is constant for any number of alternatives and variants. All combinations must have the same result
+ * type. For visitation without the indices use std::visit, which is at least as fast (bench/runtime/visit_bench.cc).
+ *
+ * @code{.cpp}
+ * std::variant<int, int> value{std::in_place_index<1>, 7};
+ * util::visit_indexed([](auto index, int alternative) { return index() * 100 + alternative; }, value); // 107
+ * @endcode
+ */
+template <typename Visitor, typename... Variants>
+requires(sizeof...(Variants) > 0 && (detail::is_std_variant_c<Variants> && ...))
+VISIT_ALWAYS_INLINE constexpr decltype(auto) visit_indexed(Visitor&& visitor, Variants&&... variants)
+{
+    using result_type = detail::first_visit_result_t<Visitor&&, Variants&&...>;
+    return detail::visit_combination<result_type>(std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);
+}
+
+} // namespace util
+
+#undef VISIT_ALWAYS_INLINE
+
+#endif // VISIT_H_INCLUDED
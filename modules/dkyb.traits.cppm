@@ -0,0 +1,121 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   modules/dkyb.traits.cppm
+ * Description: Named module dkyb.traits: the traits of include/traits.h and the macro-free member detection of
+ *              include/traits_static.h.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+module;
+
+// the headers, and the standard headers they include, are parsed once, when the module is built
+#include "traits.h"
+#include "traits_static.h"
+
+export module dkyb.traits;
+
+// The declarations stay attached to the global module, so that a translation unit may import the module and include
+// the headers as well. Specializations of the exported templates, e.g. of string_classification, are reachable
+// through the module. Macros cannot be exported: DEFINE_HAS_*_CONCEPT are replaced by has_member_function_c and
+// has_static_member_function_c.
+export namespace util
+{
+// tuples
+using util::is_tuple;
+using util::is_tuple_c;
+using util::is_tuple_like;
+using util::is_tuple_like_c;
+using util::is_tuple_like_t;
+using util::is_tuple_like_v;
+using util::is_tuple_t;
+using util::is_tuple_v;
+
+// comparisons
+using util::equality_comparable;
+using util::is_equality_comparable;
+using util::is_equality_comparable_t;
+using util::is_equality_comparable_v;
+using util::is_less_comparable;
+using util::is_less_comparable_t;
+using util::is_less_comparable_v;
+using util::less_comparable;
+
+// pack indexing
+using util::get_Nth_type;
+using util::get_Nth_type_t;
+using util::index_of_type;
+using util::index_of_type_v;
+
+// characters and strings
+using util::as_string_view;
+using util::charToChar;
+using util::dynamic_extent;
+using util::has_std_string_compatible_char;
+using util::has_std_string_compatible_char_t;
+using util::has_std_string_compatible_char_v;
+using util::is_char;
+using util::is_char_array;
+using util::is_char_array_t;
+using util::is_char_array_v;
+using util::is_char_pointer;
+using util::is_char_pointer_t;
+using util::is_char_pointer_v;
+using util::is_char_t;
+using util::is_char_v;
+using util::is_compatible_string;
+using util::is_compatible_string_t;
+using util::is_compatible_string_v;
+using util::is_std_string;
+using util::is_std_string_t;
+using util::is_std_string_v;
+using util::is_std_string_view;
+using util::is_std_string_view_t;
+using util::is_std_string_view_v;
+using util::is_string;
+using util::is_string_t;
+using util::is_string_v;
+using util::static_extent;
+using util::static_extent_v;
+using util::string_char_t;
+using util::string_classification;
+using util::string_kind;
+using util::string_kind_v;
+using util::string_or_char_size;
+
+// hashing
+using util::has_std_hash;
+using util::has_std_hash_t;
+using util::has_std_hash_v;
+
+// member detection
+using util::has_member_function_c;
+using util::has_static_member_function_c;
+} // namespace util
+
+export namespace util::simd
+{
+using util::simd::active_isa;
+using util::simd::detected_isa;
+using util::simd::first_mismatch;
+using util::simd::isa;
+using util::simd::leading_below;
+using util::simd::terminator_scan;
+} // namespace util::simd
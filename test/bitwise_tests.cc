@@ -0,0 +1,285 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/bitwise_tests.cc
+ * Description: tests for is_bitwise_equality_comparable, fast_equal, is_bitwise_hashable, byte_hash and hash_many.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "bitwise.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+struct Record
+{
+    using bitwise_equality_comparable = std::true_type;
+
+    std::uint32_t id;
+    std::uint32_t flags;
+    std::uint64_t offset;
+
+    bool operator==(Record const&) const = default;
+};
+
+// opts in, but the padding after tag makes equal values with different bytes possible
+struct PaddedRecord
+{
+    using bitwise_equality_comparable = std::true_type;
+
+    char          tag;
+    std::uint32_t value;
+
+    bool operator==(PaddedRecord const&) const = default;
+};
+
+// no padding, but does not opt in: its operator== might compare anything
+struct PlainRecord
+{
+    std::uint32_t id;
+    std::uint32_t flags;
+
+    bool operator==(PlainRecord const&) const = default;
+};
+
+// opts out explicitly
+struct OptedOut
+{
+    using bitwise_equality_comparable = std::false_type;
+
+    std::uint32_t id;
+
+    bool operator==(OptedOut const&) const = default;
+};
+
+enum class colour : std::uint8_t
+{
+    red,
+    green
+};
+
+// operator== that ignores the case of the letter, so equal values can have different bytes
+struct CaseInsensitive
+{
+    char letter;
+
+    bool operator==(CaseInsensitive const& other) const
+    {
+        return (letter | 0x20) == (other.letter | 0x20);
+    }
+};
+} // namespace
+
+template <> struct util::is_bitwise_equality_comparable<PlainRecord> : std::true_type
+{
+};
+
+class BitwiseTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(BitwiseTest, is_bitwise_equality_comparable_test)
+{
+    static_assert(is_bitwise_equality_comparable_v<int>);
+    static_assert(is_bitwise_equality_comparable_v<std::uint64_t const>);
+    static_assert(is_bitwise_equality_comparable_v<char32_t>);
+    static_assert(is_bitwise_equality_comparable_v<std::byte>);
+    static_assert(is_bitwise_equality_comparable_v<colour>);
+    static_assert(is_bitwise_equality_comparable_v<int*>);
+    static_assert(is_bitwise_equality_comparable_v<int[4]>);
+    static_assert(is_bitwise_equality_comparable_t<int>::value);
+
+    // floating point has -0.0 == 0.0 and NaN != NaN
+    static_assert(!is_bitwise_equality_comparable_v<float>);
+    static_assert(!is_bitwise_equality_comparable_v<double>);
+
+    // classes opt in, and only count if they have no padding
+    static_assert(is_bitwise_equality_comparable_v<Record>);
+    static_assert(is_bitwise_equality_comparable_v<Record[2]>);
+    static_assert(!is_bitwise_equality_comparable_v<PaddedRecord>);
+    static_assert(!is_bitwise_equality_comparable_v<OptedOut>);
+    static_assert(!is_bitwise_equality_comparable_v<CaseInsensitive>);
+    static_assert(!is_bitwise_equality_comparable_v<std::string>);
+
+    // or by specialisation
+    static_assert(is_bitwise_equality_comparable_v<PlainRecord>);
+}
+
+TEST_F(BitwiseTest, fast_equal_test)
+{
+    std::vector<Record> const records{{1, 0, 16}, {2, 1, 32}, {3, 0, 64}};
+    std::vector<Record>       copy = records;
+    ASSERT_TRUE(fast_equal(std::span{records}, std::span{copy}));
+    copy[2].offset = 65;
+    ASSERT_FALSE(fast_equal(std::span{records}, std::span{copy}));
+    ASSERT_FALSE(fast_equal(std::span{records}, std::span{copy}.first(2)));
+    ASSERT_TRUE(fast_equal(std::span{records}.first(2), std::span{copy}.first(2)));
+    ASSERT_TRUE(fast_equal(std::span<Record const>{}, std::span<Record>{}));
+
+    std::array<int, 3> const fixed{1, 2, 3};
+    std::vector<int> const   dynamic{1, 2, 3};
+    ASSERT_TRUE(fast_equal(std::span{fixed}, std::span{dynamic}));
+}
+
+TEST_F(BitwiseTest, fast_equal_element_wise_test)
+{
+    // not bitwise comparable: compared with operator==, so different bytes can still be equal
+    std::vector<CaseInsensitive> const lower{{'a'}, {'b'}};
+    std::vector<CaseInsensitive> const upper{{'A'}, {'B'}};
+    ASSERT_TRUE(fast_equal(std::span{lower}, std::span{upper}));
+
+    std::vector<double> const zeros{0.0, 0.0};
+    std::vector<double> const negative_zeros{-0.0, -0.0};
+    ASSERT_TRUE(fast_equal(std::span{zeros}, std::span{negative_zeros}));
+
+    std::vector<std::string> const words{"fast", "equal"};
+    std::vector<std::string> const same{"fast", "equal"};
+    std::vector<std::string> const other{"fast", "equals"};
+    ASSERT_TRUE(fast_equal(std::span{words}, std::span{same}));
+    ASSERT_FALSE(fast_equal(std::span{words}, std::span{other}));
+}
+
+TEST_F(BitwiseTest, fast_equal_constexpr_test)
+{
+    static constexpr std::array<int, 3> lhs{1, 2, 3};
+    static constexpr std::array<int, 3> rhs{1, 2, 3};
+    static_assert(fast_equal(std::span{lhs}, std::span{rhs}));
+}
+
+TEST_F(BitwiseTest, is_bitwise_hashable_test)
+{
+    static_assert(is_bitwise_hashable_v<int>);
+    static_assert(is_bitwise_hashable_v<colour>);
+    static_assert(is_bitwise_hashable_v<Record>);
+    static_assert(is_bitwise_hashable_v<PlainRecord>);
+    static_assert(is_bitwise_hashable_v<std::uint16_t[3]>);
+    static_assert(is_bitwise_hashable_t<Record>::value);
+
+    static_assert(!is_bitwise_hashable_v<double>);
+    static_assert(!is_bitwise_hashable_v<PaddedRecord>);
+    static_assert(!is_bitwise_hashable_v<std::string>);
+}
+
+TEST_F(BitwiseTest, multiply_wide_test)
+{
+    std::uint64_t low  = ~std::uint64_t{0};
+    std::uint64_t high = ~std::uint64_t{0};
+    util::detail::multiply_wide(low, high);
+    ASSERT_EQ(low, 1ULL);
+    ASSERT_EQ(high, ~std::uint64_t{0} - 1);
+
+    low  = 0x1'0000'0001ULL;
+    high = 0x1'0000'0000ULL;
+    util::detail::multiply_wide(low, high);
+    ASSERT_EQ(low, 0x1'0000'0000ULL);
+    ASSERT_EQ(high, 1ULL);
+}
+
+TEST_F(BitwiseTest, hash_bytes_test)
+{
+    std::vector<unsigned char> bytes(256);
+    for (size_t index = 0; index < bytes.size(); ++index)
+    {
+        bytes[index] = static_cast<unsigned char>(index * 7 + 1);
+    }
+
+    // every length takes its own path through the hash, and every prefix hashes differently
+    std::unordered_set<size_t> prefixes;
+    for (size_t size = 0; size <= bytes.size(); ++size)
+    {
+        ASSERT_EQ(hash_bytes(bytes.data(), size), hash_bytes(bytes.data(), size));
+        prefixes.insert(hash_bytes(bytes.data(), size));
+    }
+    ASSERT_EQ(prefixes.size(), bytes.size() + 1);
+
+    // a change of any bit of the input changes the hash
+    for (size_t size : {1UL, 3UL, 4UL, 8UL, 16UL, 17UL, 48UL, 49UL, 100UL})
+    {
+        std::vector<unsigned char> copy(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(size));
+        size_t const               original = hash_bytes(copy.data(), size);
+        for (size_t bit = 0; bit < size * 8; ++bit)
+        {
+            copy[bit / 8] ^= static_cast<unsigned char>(1U << (bit % 8));
+            ASSERT_NE(hash_bytes(copy.data(), size), original) << size << " bytes, bit " << bit;
+            copy[bit / 8] ^= static_cast<unsigned char>(1U << (bit % 8));
+        }
+    }
+
+    ASSERT_NE(hash_bytes(bytes.data(), 32, 1), hash_bytes(bytes.data(), 32, 2));
+}
+
+TEST_F(BitwiseTest, byte_hash_test)
+{
+    Record const record{7, 1, 4096};
+    ASSERT_EQ(byte_hash<Record>{}(record), hash_bytes(&record, sizeof(record)));
+    ASSERT_EQ(byte_hash<Record>{}(record), byte_hash<Record>{}(Record{7, 1, 4096}));
+    ASSERT_NE(byte_hash<Record>{}(record), byte_hash<Record>{}(Record{7, 1, 4097}));
+
+    std::unordered_map<Record, int, byte_hash<Record>> counts;
+    ++counts[record];
+    ++counts[Record{7, 1, 4096}];
+    ++counts[Record{8, 1, 4096}];
+    ASSERT_EQ(counts.size(), 2UL);
+    ASSERT_EQ(counts[record], 2);
+}
+
+TEST_F(BitwiseTest, hash_many_test)
+{
+    std::vector<Record> records;
+    for (std::uint32_t index = 0; index < 100; ++index)
+    {
+        records.push_back({index, index % 3, index * 64ULL});
+    }
+
+    std::vector<size_t> hashes(records.size());
+    auto const          written = hash_many(std::span<Record const>{records}, std::span{hashes});
+    ASSERT_EQ(written.size(), records.size());
+    for (size_t index = 0; index < records.size(); ++index)
+    {
+        ASSERT_EQ(hashes[index], byte_hash<Record>{}(records[index]));
+    }
+
+    // no more hashes than there is room for
+    std::array<size_t, 10> few{};
+    ASSERT_EQ(hash_many(std::span{records}, std::span{few}).size(), few.size());
+    ASSERT_EQ(few.back(), hashes[9]);
+}
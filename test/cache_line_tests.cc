@@ -0,0 +1,147 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/cache_line_tests.cc
+ * Description: tests for the cache-line traits and wrappers.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "cache_line.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+uintptr_t line_of(void const* address)
+{
+    return reinterpret_cast<uintptr_t>(address) / cache_line_size_v;
+}
+
+/**
+ * @brief A padded value between two bytes that other threads might write.
+ */
+struct Neighbours
+{
+    char          before;
+    padded<short> value;
+    char          after;
+};
+} // namespace
+
+class CacheLineTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(CacheLineTest, cache_line_size_test)
+{
+    static_assert(cache_line_size_v >= 32);
+    static_assert((cache_line_size_v & (cache_line_size_v - 1)) == 0);
+#if defined(__cpp_lib_hardware_interference_size) && !defined(CACHE_LINE_SIZE)
+    static_assert(cache_line_size_v == std::hardware_destructive_interference_size);
+#endif
+}
+
+TEST_F(CacheLineTest, cache_line_traits_test)
+{
+    static_assert(fits_in_cache_line_v<int64_t>);
+    static_assert(fits_in_cache_line_v<std::array<char, cache_line_size_v>>);
+    static_assert(!fits_in_cache_line_v<std::array<char, cache_line_size_v + 1>>);
+    static_assert(is_same_v<fits_in_cache_line_t<int>, true_type>);
+
+    static_assert(shares_cache_line_v<std::atomic<long>, 8>);
+    static_assert(shares_cache_line_v<std::array<char, cache_line_size_v>, 2>); // straddles line boundaries
+    static_assert(!shares_cache_line_v<std::atomic<long>, 1>);
+    static_assert(!shares_cache_line_v<cache_aligned<std::atomic<long>>, 8>);
+    static_assert(!shares_cache_line_v<cache_aligned<std::array<char, cache_line_size_v + 1>>, 8>);
+    static_assert(!shares_cache_line_v<padded<std::atomic<long>>, 8>);
+    static_assert(!shares_cache_line_v<padded<std::array<char, cache_line_size_v / 2>>, 8>);
+    static_assert(is_same_v<shares_cache_line_t<char, 2>, true_type>);
+}
+
+TEST_F(CacheLineTest, cache_aligned_test)
+{
+    static_assert(alignof(cache_aligned<char>) == cache_line_size_v);
+    static_assert(sizeof(cache_aligned<char>) == cache_line_size_v);
+    static_assert(sizeof(cache_aligned<std::array<char, cache_line_size_v + 1>>) == 2 * cache_line_size_v);
+
+    std::array<cache_aligned<std::atomic<long>>, 4> counters{};
+    for (size_t index = 0; index < counters.size(); ++index)
+    {
+        counters[index]->fetch_add(static_cast<long>(index) + 1);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(&counters[index].value) % cache_line_size_v, 0UL);
+    }
+    ASSERT_EQ(counters[3]->load(), 4);
+    ASSERT_NE(line_of(&counters[0].value), line_of(&counters[1].value));
+
+    cache_aligned<std::string> text{std::in_place, 3, 'x'};
+    ASSERT_EQ(*text, "xxx");
+    ASSERT_EQ(text->size(), 3UL);
+
+    // over-aligned heap allocation
+    auto const heap = std::make_unique<cache_aligned<int>>(std::in_place, 5);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(heap.get()) % cache_line_size_v, 0UL);
+    ASSERT_EQ(**heap, 5);
+}
+
+TEST_F(CacheLineTest, padded_test)
+{
+    static_assert(alignof(padded<short>) == alignof(short));
+    static_assert(sizeof(padded<short>) >= 2 * cache_line_size_v);
+
+    Neighbours neighbours{};
+    ASSERT_NE(line_of(&neighbours.before), line_of(&neighbours.value.value));
+    ASSERT_NE(line_of(&neighbours.after), line_of(&neighbours.value.value));
+
+    // and between the elements of an array
+    alignas(cache_line_size_v) std::array<padded<short>, 2 * cache_line_size_v / sizeof(short)> values{};
+    static_assert(!shares_cache_line_v<padded<short>, values.size()>);
+    for (size_t index = 0; index + 1 < values.size(); ++index)
+    {
+        auto const* first  = reinterpret_cast<char const*>(&values[index].value);
+        auto const* second = reinterpret_cast<char const*>(&values[index + 1].value);
+        ASSERT_NE(line_of(first + sizeof(short) - 1), line_of(second));
+        ASSERT_NE(line_of(first + sizeof(short) - 1), line_of(reinterpret_cast<char const*>(&values[index + 1])));
+    }
+
+    padded<std::string> text{std::in_place, "padded"};
+    ASSERT_EQ(*text, "padded");
+    *text += '!';
+    ASSERT_EQ(text->size(), 7UL);
+}
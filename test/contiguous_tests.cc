@@ -0,0 +1,174 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/contiguous_tests.cc
+ * Description: tests for the contiguous-range traits, copy_into and equal_ranges.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "contiguous.h"
+
+#include <array>
+#include <deque>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class ContiguousTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(ContiguousTest, is_contiguous_range_test)
+{
+    static_assert(is_contiguous_range_v<std::string>);
+    static_assert(is_contiguous_range_v<std::u16string_view const&>);
+    static_assert(is_contiguous_range_v<char const*>);
+    static_assert(is_contiguous_range_v<wchar_t[8]>);
+    static_assert(is_contiguous_range_v<std::vector<double>>);
+    static_assert(is_contiguous_range_v<std::array<int, 3>>);
+    static_assert(is_contiguous_range_v<std::span<int const>>);
+    static_assert(is_contiguous_range_v<int[4]>);
+    static_assert(is_contiguous_range_t<std::vector<std::string>>::value);
+
+    static_assert(!is_contiguous_range_v<std::vector<bool>>);
+    static_assert(!is_contiguous_range_v<std::list<int>>);
+    static_assert(!is_contiguous_range_v<std::deque<int>>);
+    static_assert(!is_contiguous_range_v<int>);
+    static_assert(!is_contiguous_range_v<int*>);
+
+    static_assert(std::is_same_v<contiguous_value_t<char const*>, char>);
+    static_assert(std::is_same_v<contiguous_value_t<char16_t const[3]>, char16_t>);
+    static_assert(std::is_same_v<contiguous_value_t<std::vector<long> const&>, long>);
+    static_assert(std::is_same_v<contiguous_value_t<std::span<int const>>, int>);
+    static_assert(std::is_same_v<contiguous_value_t<double[2]>, double>);
+}
+
+TEST_F(ContiguousTest, is_trivially_copyable_range_test)
+{
+    struct Point
+    {
+        int x;
+        int y;
+    };
+
+    static_assert(is_trivially_copyable_range_v<std::string>);
+    static_assert(is_trivially_copyable_range_v<std::vector<Point>>);
+    static_assert(is_trivially_copyable_range_v<std::array<double, 2>>);
+    static_assert(is_trivially_copyable_range_v<int[4]>);
+    static_assert(is_trivially_copyable_range_t<std::span<Point>>::value);
+
+    static_assert(!is_trivially_copyable_range_v<std::vector<std::string>>);
+    static_assert(!is_trivially_copyable_range_v<std::list<int>>);
+    static_assert(!is_trivially_copyable_range_v<int>);
+}
+
+TEST_F(ContiguousTest, as_span_test)
+{
+    char const             array[16] = "abc";
+    std::vector<int> const vec{1, 2, 3};
+
+    ASSERT_EQ(as_span(array).size(), 3UL); // up to the terminator, like as_string_view
+    ASSERT_EQ(as_span("literal").size(), 7UL);
+    ASSERT_EQ(as_span(vec).data(), vec.data());
+    ASSERT_EQ(as_span(vec).size(), 3UL);
+    ASSERT_EQ(as_span(std::u32string(U"xy")).size(), 2UL);
+}
+
+TEST_F(ContiguousTest, copy_into_test)
+{
+    std::vector<int> const source{1, 2, 3, 4};
+    std::vector<int>       dest(6, 0);
+
+    ASSERT_EQ(copy_into(source, dest.begin()), dest.begin() + 4);
+    ASSERT_EQ(dest, (std::vector<int>{1, 2, 3, 4, 0, 0}));
+
+    std::array<char, 8> buffer{};
+    ASSERT_EQ(copy_into("abc", buffer.data()), buffer.data() + 3);
+    ASSERT_EQ(std::string_view(buffer.data()), "abc");
+
+    // generic paths: converting, non-contiguous source, non-contiguous destination
+    std::vector<long> widened(4);
+    copy_into(source, widened.begin());
+    ASSERT_EQ(widened, (std::vector<long>{1, 2, 3, 4}));
+
+    std::list<int> const nodes{5, 6};
+    copy_into(nodes, dest.begin() + 4);
+    ASSERT_EQ(dest, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+
+    std::vector<std::string> appended;
+    std::vector<std::string> const words{"one", "two"};
+    copy_into(words, std::back_inserter(appended));
+    ASSERT_EQ(appended, words);
+
+    std::string empty_dest;
+    copy_into(std::string{}, empty_dest.data());
+    ASSERT_TRUE(empty_dest.empty());
+
+    static_assert(
+        []
+        {
+            std::array<int, 3> result{};
+            copy_into(std::array{7, 8, 9}, result.begin());
+            return result[2];
+        }() == 9);
+}
+
+TEST_F(ContiguousTest, equal_ranges_test)
+{
+    std::vector<int> const vec{1, 2, 3};
+    int const              array[]{1, 2, 3};
+
+    ASSERT_TRUE(equal_ranges(vec, std::array{1, 2, 3}));
+    ASSERT_TRUE(equal_ranges(vec, array));
+    ASSERT_TRUE(equal_ranges(vec, std::span<int const>(array)));
+    ASSERT_FALSE(equal_ranges(vec, std::array{1, 2, 4}));
+    ASSERT_FALSE(equal_ranges(vec, std::array{1, 2}));
+    ASSERT_TRUE(equal_ranges(std::vector<int>{}, std::array<int, 0>{}));
+
+    ASSERT_TRUE(equal_ranges(std::string("abc"), "abc"));
+    ASSERT_FALSE(equal_ranges(std::string("abc"), "abcd"));
+    ASSERT_TRUE(equal_ranges(std::u16string_view(u"xy"), u"xy"));
+
+    // element by element: floating point, mixed element types and non-contiguous ranges
+    ASSERT_TRUE(equal_ranges(std::vector<double>{0.0}, std::vector<double>{-0.0}));
+    ASSERT_TRUE(equal_ranges(vec, std::vector<long>{1, 2, 3}));
+    ASSERT_TRUE(equal_ranges(std::list<int>{1, 2, 3}, vec));
+    ASSERT_FALSE(equal_ranges(std::list<int>{1, 2}, vec));
+    ASSERT_TRUE(equal_ranges(std::vector<std::string>{"a"}, std::list<std::string>{"a"}));
+
+    static_assert(equal_ranges(std::array{1, 2}, std::array{1, 2}));
+    static_assert(!equal_ranges(std::string_view("ab"), "ac"));
+}
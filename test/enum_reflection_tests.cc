@@ -0,0 +1,252 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/enum_reflection_tests.cc
+ * Description: tests for enum reflection.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "enum_reflection.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+enum class level
+{
+    debug,
+    info,
+    warning,
+    error
+};
+
+enum class sparse : int16_t
+{
+    lowest   = -100,
+    negative = -1,
+    zero     = 0,
+    alias    = zero,
+    highest  = 127,
+    outside  = 1'000
+};
+
+enum unscoped : uint8_t
+{
+    first_value  = 1,
+    second_value = 2,
+    too_large    = 200
+};
+
+enum class none
+{
+};
+
+// no fixed underlying type: only the values of the smallest bit-field holding the enumerators, [0, 3], are valid
+enum color
+{
+    red,
+    green,
+    blue
+};
+
+// the same with a fixed underlying type
+enum fixed_color : int
+{
+    fixed_red,
+    fixed_green,
+    fixed_blue
+};
+
+// character and bool underlying types, which std::cmp_less does not take
+enum class letter : char
+{
+    a = 'a',
+    b = 'b',
+    z = 'z'
+};
+
+enum class answer : bool
+{
+    no,
+    yes
+};
+
+enum class byte_code : unsigned char
+{
+    nul = 0,
+    del = 127
+};
+
+template <typename E>
+concept has_enum_name = requires(E value) { enum_name(value); };
+
+template <typename E>
+concept has_enum_count = requires { typename enum_count<E>::type; };
+
+struct holder
+{
+    enum class nested
+    {
+        inner
+    };
+};
+
+enum class http_status
+{
+    ok                    = 200,
+    not_found             = 404,
+    internal_server_error = 500
+};
+} // namespace
+
+template <> struct util::enum_range<http_status>
+{
+    static constexpr int min = 100;
+    static constexpr int max = 599;
+};
+
+class EnumReflectionTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(EnumReflectionTest, reflectable_enum_test)
+{
+    ASSERT_TRUE(has_fixed_underlying_type_v<level>);
+    ASSERT_TRUE(has_fixed_underlying_type_v<unscoped>);
+    ASSERT_TRUE(has_fixed_underlying_type_v<fixed_color>);
+    ASSERT_FALSE(has_fixed_underlying_type_v<color>);
+    ASSERT_FALSE(has_fixed_underlying_type_v<int>);
+    ASSERT_TRUE((std::is_same_v<has_fixed_underlying_type_t<sparse>, std::true_type>));
+
+    ASSERT_TRUE(is_reflectable_enum_c<level>);
+    ASSERT_TRUE(is_reflectable_enum_c<fixed_color>);
+    ASSERT_TRUE(is_reflectable_enum_c<letter>);
+    ASSERT_TRUE(is_reflectable_enum_c<answer>);
+    ASSERT_FALSE(is_reflectable_enum_c<color>);
+    ASSERT_FALSE(is_reflectable_enum_c<int>);
+
+    // rejected by the constraints instead of converting out-of-range values to color
+    ASSERT_TRUE(has_enum_name<fixed_color>);
+    ASSERT_FALSE(has_enum_name<color>);
+    ASSERT_TRUE(has_enum_count<fixed_color>);
+    ASSERT_FALSE(has_enum_count<color>);
+
+    ASSERT_EQ(enum_count_v<fixed_color>, 3UL);
+    ASSERT_EQ(enum_name(fixed_blue), "fixed_blue");
+}
+
+TEST_F(EnumReflectionTest, enum_count_test)
+{
+    ASSERT_EQ(enum_count_v<level>, 4UL);
+    ASSERT_EQ(enum_count_v<sparse>, 4UL);  // alias shares a value, outside is out of range
+    ASSERT_EQ(enum_count_v<unscoped>, 2UL); // too_large is out of range
+    ASSERT_EQ(enum_count_v<none>, 0UL);
+    ASSERT_EQ(enum_count_v<holder::nested>, 1UL);
+    ASSERT_EQ(enum_count_v<http_status>, 3UL);
+    ASSERT_EQ(enum_count_v<letter>, 3UL);
+    ASSERT_EQ(enum_count_v<answer>, 2UL);
+    ASSERT_EQ(enum_count_v<byte_code>, 2UL);
+    ASSERT_TRUE((std::is_same_v<enum_count_t<level>, std::integral_constant<size_t, 4>>));
+}
+
+TEST_F(EnumReflectionTest, enum_values_and_names_test)
+{
+    ASSERT_EQ(enum_values_v<sparse>[0], sparse::lowest);
+    ASSERT_EQ(enum_values_v<sparse>[1], sparse::negative);
+    ASSERT_EQ(enum_values_v<sparse>[2], sparse::zero);
+    ASSERT_EQ(enum_values_v<sparse>[3], sparse::highest);
+
+    ASSERT_EQ(enum_names_v<level>[0], "debug");
+    ASSERT_EQ(enum_names_v<level>[3], "error");
+    ASSERT_EQ(enum_names_v<sparse>[2], "zero");
+    ASSERT_EQ(enum_names_v<unscoped>[1], "second_value");
+    ASSERT_EQ(enum_names_v<holder::nested>[0], "inner");
+}
+
+TEST_F(EnumReflectionTest, enum_name_test)
+{
+    static_assert(enum_name(level::warning) == "warning");
+
+    ASSERT_EQ(enum_name(level::debug), "debug");
+    ASSERT_EQ(enum_name(sparse::lowest), "lowest");
+    ASSERT_EQ(enum_name(sparse::alias), "zero");
+    ASSERT_EQ(enum_name(first_value), "first_value");
+    ASSERT_EQ(enum_name(http_status::not_found), "not_found");
+    ASSERT_EQ(enum_name(letter::z), "z");
+    ASSERT_EQ(enum_name(answer::yes), "yes");
+    ASSERT_EQ(enum_name(byte_code::del), "del");
+
+    ASSERT_EQ(enum_name(static_cast<level>(4)), "");
+    ASSERT_EQ(enum_name(static_cast<level>(-1)), "");
+    ASSERT_EQ(enum_name(sparse::outside), "");
+    ASSERT_EQ(enum_name(too_large), "");
+    ASSERT_EQ(enum_name(static_cast<http_status>(42)), "");
+    ASSERT_EQ(enum_name(static_cast<letter>('c')), "");
+    ASSERT_EQ(enum_name(static_cast<byte_code>(200)), "");
+}
+
+TEST_F(EnumReflectionTest, enum_from_string_test)
+{
+    static_assert(enum_from_string<level>("info") == level::info);
+
+    std::string const      owned = "error";
+    std::string_view const view  = "warning";
+    char const*            ptr   = "debug";
+
+    ASSERT_EQ(enum_from_string<level>(owned), level::error);
+    ASSERT_EQ(enum_from_string<level>(view), level::warning);
+    ASSERT_EQ(enum_from_string<level>(ptr), level::debug);
+    ASSERT_EQ(enum_from_string<sparse>("negative"), sparse::negative);
+    ASSERT_EQ(enum_from_string<http_status>("internal_server_error"), http_status::internal_server_error);
+    ASSERT_EQ(enum_from_string<letter>("b"), letter::b);
+    ASSERT_EQ(enum_from_string<answer>("no"), answer::no);
+
+    ASSERT_EQ(enum_from_string<level>("Info"), std::nullopt);
+    ASSERT_EQ(enum_from_string<level>("inf"), std::nullopt);
+    ASSERT_EQ(enum_from_string<level>(""), std::nullopt);
+    ASSERT_EQ(enum_from_string<sparse>("alias"), std::nullopt);
+    ASSERT_EQ(enum_from_string<none>("anything"), std::nullopt);
+}
+
+TEST_F(EnumReflectionTest, round_trip_test)
+{
+    for (size_t position = 0; position < enum_count_v<sparse>; ++position)
+    {
+        sparse const value = enum_values_v<sparse>[position];
+        ASSERT_EQ(enum_from_string<sparse>(enum_name(value)), value);
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/fixed_string_tests.cc
+ * Description: tests for fixed_string.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "fixed_string.h"
+#include "string_compare.h"
+#include "string_concat.h"
+#include "string_hash.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+template <fixed_string Name> struct field
+{
+    static constexpr std::string_view name = Name;
+};
+} // namespace
+
+class FixedStringTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(FixedStringTest, deduction_test)
+{
+    constexpr fixed_string narrow = "GET";
+    constexpr fixed_string wide   = L"wide";
+    constexpr fixed_string empty  = "";
+
+    static_assert(std::is_same_v<std::remove_cv_t<decltype(narrow)>, fixed_string<3, char>>);
+    static_assert(std::is_same_v<std::remove_cv_t<decltype(wide)>, fixed_string<4, wchar_t>>);
+    static_assert(narrow.size() == 3 && !narrow.empty());
+    static_assert(empty.size() == 0 && empty.empty());
+    static_assert(narrow[0] == 'G' && narrow.c_str()[3] == '\0');
+
+    ASSERT_EQ(narrow.view(), "GET");
+    ASSERT_EQ(wide.view(), L"wide");
+    ASSERT_EQ(std::string(narrow.begin(), narrow.end()), "GET");
+}
+
+TEST_F(FixedStringTest, traits_test)
+{
+    using get_type = fixed_string<3>;
+
+    ASSERT_TRUE(is_fixed_string_v<get_type>);
+    ASSERT_FALSE(is_fixed_string_v<std::string>);
+    ASSERT_TRUE(is_fixed_string<get_type>::value);
+    ASSERT_TRUE((std::is_same_v<is_fixed_string_t<get_type>, std::true_type>));
+
+    ASSERT_TRUE(is_string_v<get_type>);
+    ASSERT_TRUE((std::is_same_v<string_char_t<fixed_string<2, char16_t>>, char16_t>));
+    ASSERT_EQ(string_kind_v<get_type>, string_kind::fixed_string);
+    ASSERT_EQ(static_extent_v<get_type>, 3UL);
+    ASSERT_TRUE((is_compatible_string_v<get_type, std::string>));
+    ASSERT_TRUE((is_compatible_string_v<char const*, get_type>));
+    ASSERT_FALSE((is_compatible_string_v<get_type, std::wstring>));
+}
+
+TEST_F(FixedStringTest, template_argument_test)
+{
+    ASSERT_EQ(field<"user_id">::name, "user_id");
+    ASSERT_TRUE((std::is_same_v<field<"id">, field<"id">>));
+    ASSERT_FALSE((std::is_same_v<field<"id">, field<"ID">>));
+}
+
+TEST_F(FixedStringTest, comparison_test)
+{
+    constexpr fixed_string alpha = "alpha";
+    constexpr fixed_string beta  = "beta";
+
+    static_assert(alpha == fixed_string("alpha"));
+    static_assert(alpha != beta);
+    static_assert(alpha < beta);
+    static_assert(fixed_string("ab") < fixed_string("abc"));
+    static_assert(alpha == std::string_view("alpha"));
+
+    ASSERT_TRUE(string_equal{}(alpha, std::string("alpha")));
+    ASSERT_TRUE(string_less{}(alpha, "beta"));
+    ASSERT_EQ(as_string_view(beta), "beta");
+}
+
+TEST_F(FixedStringTest, interoperability_test)
+{
+    constexpr fixed_string scheme = "https";
+
+    ASSERT_EQ(concat(scheme, "://", std::string("example.com")), "https://example.com");
+    ASSERT_EQ(string_hash{}(scheme), string_hash{}(std::string("https")));
+
+    std::unordered_map<std::string, int, string_hash, string_equal> ports{{"https", 443}};
+    ASSERT_EQ(ports.find(scheme)->second, 443);
+}
@@ -0,0 +1,171 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/packed_tuple_tests.cc
+ * Description: tests for packed_tuple and padding_bytes.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "packed_tuple.h"
+#include "tuple_algorithms.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+struct Empty
+{
+};
+
+struct alignas(16) Wide
+{
+    char bytes[16];
+};
+} // namespace
+
+class PackedTupleTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(PackedTupleTest, padding_bytes_test)
+{
+    static_assert(padding_bytes_v<> == 0);
+    static_assert(padding_bytes_v<int> == 0);
+    static_assert(padding_bytes_v<bool, int64_t, char> == 14);
+    static_assert(padding_bytes_v<int64_t, bool, char> == 6);
+    static_assert(padding_bytes_v<char, int32_t> == 3);
+    static_assert(padding_bytes_v<int32_t, char> == 3);
+    static_assert(padding_bytes_v<char, Wide> == 15);
+    static_assert(is_same_v<padding_bytes_t<char, int16_t>, integral_constant<size_t, 1>>);
+
+    // agrees with the compiler's layout of the same members
+    struct bool_int64_char
+    {
+        bool    a;
+        int64_t b;
+        char    c;
+    };
+    static_assert(sizeof(bool_int64_char) == sizeof(bool) + sizeof(int64_t) + sizeof(char) +
+                                                 padding_bytes_v<bool, int64_t, char>);
+}
+
+TEST_F(PackedTupleTest, packed_tuple_layout_test)
+{
+    static_assert(sizeof(packed_tuple<bool, int64_t, char>) == 16);
+    static_assert(sizeof(packed_tuple<bool, int64_t, char>) < sizeof(std::tuple<bool, int64_t, char>));
+    static_assert(sizeof(packed_tuple<char, int32_t, char, int16_t, char>) == 12);
+    static_assert(sizeof(packed_tuple<char, Wide, char>) == 32);
+    static_assert(alignof(packed_tuple<char, Wide>) == 16);
+    static_assert(sizeof(packed_tuple<int32_t, Empty, char>) == 8);
+
+    packed_tuple<bool, int64_t, char> row{true, 42, 'x'};
+    auto const*                       base = reinterpret_cast<char const*>(&row);
+    // the widest element comes first, the others follow without padding
+    ASSERT_EQ(reinterpret_cast<char const*>(&row.get<1>()) - base, 0);
+    ASSERT_EQ(reinterpret_cast<char const*>(&row.get<0>()) - base, 8);
+    ASSERT_EQ(reinterpret_cast<char const*>(&row.get<2>()) - base, 9);
+}
+
+TEST_F(PackedTupleTest, packed_tuple_access_test)
+{
+    packed_tuple<bool, int64_t, char> row{true, 42, 'x'};
+    ASSERT_TRUE(row.get<0>());
+    ASSERT_EQ(row.get<1>(), 42);
+    ASSERT_EQ(get<2>(row), 'x');
+
+    row.get<1>() = 7;
+    get<2>(row)  = 'y';
+
+    auto& [valid, id, code] = row;
+    ASSERT_TRUE(valid);
+    ASSERT_EQ(id, 7);
+    ASSERT_EQ(code, 'y');
+
+    static_assert(is_same_v<decltype(row.get<1>()), int64_t&>);
+    static_assert(is_same_v<decltype(std::as_const(row).get<1>()), int64_t const&>);
+    static_assert(is_same_v<decltype(std::move(row).get<1>()), int64_t&&>);
+    static_assert(is_same_v<decltype(get<0>(std::move(row))), bool&&>);
+
+    // default construction value-initialises
+    packed_tuple<int, double, char> zero;
+    ASSERT_EQ(zero, (packed_tuple<int, double, char>{0, 0.0, '\0'}));
+
+    // repeated element types are distinct elements
+    packed_tuple<int, char, int> twice{1, 'a', 2};
+    ASSERT_EQ(twice.get<0>(), 1);
+    ASSERT_EQ(twice.get<2>(), 2);
+
+    // move-only elements are moved in and out
+    packed_tuple<char, std::unique_ptr<int>> owner{'o', std::make_unique<int>(5)};
+    auto                                     moved = std::move(owner);
+    ASSERT_EQ(*moved.get<1>(), 5);
+    auto owned = get<1>(std::move(moved));
+    ASSERT_EQ(*owned, 5);
+
+    // class template argument deduction
+    packed_tuple deduced{'c', 2.5, std::string("s")};
+    static_assert(is_same_v<decltype(deduced), packed_tuple<char, double, std::string>>);
+    ASSERT_EQ(deduced.get<2>(), "s");
+
+    constexpr packed_tuple<char, int64_t> compile_time{'a', 3};
+    static_assert(compile_time.get<1>() == 3);
+}
+
+TEST_F(PackedTupleTest, packed_tuple_traits_test)
+{
+    using row = packed_tuple<bool, int64_t, char>;
+    static_assert(std::tuple_size_v<row> == 3);
+    static_assert(is_same_v<std::tuple_element_t<1, row>, int64_t>);
+    static_assert(is_tuple_v<row>);
+    static_assert(is_tuple_like_v<row>);
+    static_assert(is_tuple_like_v<row const>);
+    static_assert(is_packed_tuple_v<row>);
+    static_assert(!is_packed_tuple_v<std::tuple<bool, int64_t, char>>);
+    static_assert(is_same_v<type_list_from_tuple_t<row>, type_list<bool, int64_t, char>>);
+    static_assert(is_trivially_copyable_v<row>);
+    static_assert(is_trivially_relocatable_v<row>);
+    static_assert(is_trivially_relocatable_v<packed_tuple<int, std::unique_ptr<int>>>);
+    static_assert(!is_trivially_relocatable_v<packed_tuple<int, std::list<int>>>);
+
+    // the tuple algorithms visit the elements in declared order
+    std::string visited;
+    tuple_for_each(row{true, 42, 'x'}, [&visited](auto element) { visited += std::to_string(element) + ','; });
+    ASSERT_EQ(visited, "1,42,120,");
+}
@@ -0,0 +1,306 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/relocate_tests.cc
+ * Description: tests for the trivial-relocatability trait and the relocation algorithms.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "relocate.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+/**
+ * @brief Counts constructions, moves and destructions; optionally throws on the n-th move.
+ */
+struct Tracked
+{
+    static inline int live     = 0;
+    static inline int moves    = 0;
+    static inline int throw_at = -1;
+
+    int value;
+
+    explicit Tracked(int v)
+        : value(v)
+    {
+        ++live;
+    }
+
+    Tracked(Tracked&& other)
+        : value(other.value)
+    {
+        if (moves++ == throw_at)
+        {
+            throw std::runtime_error("move");
+        }
+        ++live;
+    }
+
+    Tracked(Tracked const&)            = delete;
+    Tracked& operator=(Tracked const&) = delete;
+    Tracked& operator=(Tracked&&)      = delete;
+
+    ~Tracked()
+    {
+        --live;
+    }
+
+    static void reset()
+    {
+        live     = 0;
+        moves    = 0;
+        throw_at = -1;
+    }
+};
+
+/**
+ * @brief Same as Tracked, but opts in through the member typedef, so it is relocated without moves.
+ */
+struct TrackedRelocatable : Tracked
+{
+    using trivially_relocatable = relocatable_if<TrackedRelocatable>;
+    using Tracked::Tracked;
+};
+
+struct OptedOut
+{
+    using trivially_relocatable = relocatable_if<OptedOut, false>;
+    int value;
+};
+
+struct Specialised
+{
+    std::string name; // NOSONAR
+};
+
+struct Composed
+{
+    using trivially_relocatable = relocatable_if<Composed, all_trivially_relocatable_v<std::unique_ptr<int>, int>>;
+    std::unique_ptr<int> data;
+    int                  size;
+};
+
+/**
+ * @brief Inherits the opt-in of Composed, but adds a member that may point into the object itself.
+ */
+struct DerivedComposed : Composed
+{
+    std::string name; // NOSONAR
+};
+
+/**
+ * @brief Derived class that repeats the opt-in for itself.
+ */
+struct DerivedRelocatable : Composed
+{
+    using trivially_relocatable = relocatable_if<DerivedRelocatable>;
+    long extra;
+};
+
+/**
+ * @brief A typedef that does not name a class is not an opt-in.
+ */
+struct UnnamedOptIn
+{
+    using trivially_relocatable = std::true_type;
+    std::string name; // NOSONAR
+};
+
+/**
+ * @brief Uninitialised storage for count objects of T.
+ */
+template <typename T> struct raw_buffer
+{
+    explicit raw_buffer(size_t count)
+        : storage(new std::byte[count * sizeof(T)])
+    {
+    }
+
+    T* data()
+    {
+        return reinterpret_cast<T*>(storage.get());
+    }
+
+    std::unique_ptr<std::byte[]> storage;
+};
+} // namespace
+
+template <> struct util::is_trivially_relocatable<Specialised> : std::true_type
+{
+};
+
+class RelocateTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Tracked::reset();
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(RelocateTest, is_trivially_relocatable_test)
+{
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(is_trivially_relocatable_v<int*>);
+    static_assert(is_trivially_relocatable_v<std::string_view>);
+    static_assert(is_trivially_relocatable_v<std::pair<int, double>>);
+    static_assert(is_trivially_relocatable_v<int[4]>);
+
+    // conservative default for classes with user-provided special members
+    static_assert(!is_trivially_relocatable_v<Tracked>);
+    static_assert(!is_trivially_relocatable_v<Tracked[2]>);
+    static_assert(!is_trivially_relocatable_v<std::pair<Tracked, int>>);
+
+    // opt-in and opt-out hooks
+    static_assert(is_trivially_relocatable_v<TrackedRelocatable>);
+    static_assert(is_trivially_relocatable_v<std::tuple<TrackedRelocatable, int>>);
+    static_assert(is_trivially_relocatable_v<OptedOut>); // trivially copyable regardless
+    static_assert(is_trivially_relocatable_v<Specialised>);
+    static_assert(is_trivially_relocatable_t<Specialised>::value);
+    static_assert(!is_trivially_relocatable_v<DerivedComposed>);
+    static_assert(!is_trivially_relocatable_v<UnnamedOptIn>);
+    static_assert(all_trivially_relocatable_v<int, double>);
+
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+    static_assert(is_trivially_relocatable_v<Composed>);
+    static_assert(is_trivially_relocatable_v<DerivedRelocatable>);
+    static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(is_trivially_relocatable_v<std::shared_ptr<int>>);
+    static_assert(is_trivially_relocatable_v<std::vector<std::string>>);
+#endif
+#if defined(__GLIBCXX__)
+    static_assert(!is_trivially_relocatable_v<std::string>);
+    static_assert(!is_trivially_relocatable_v<std::pair<std::string, int>>);
+#endif
+}
+
+TEST_F(RelocateTest, relocate_trivially_copyable_test)
+{
+    int source[] = {1, 2, 3, 4, 5};
+    int dest[5]{};
+    ASSERT_EQ(relocate(source, source + 5, dest), dest + 5);
+    ASSERT_EQ(std::vector<int>(dest, dest + 5), (std::vector<int>{1, 2, 3, 4, 5}));
+
+    // overlapping in both directions
+    int overlap[] = {1, 2, 3, 4, 5, 0, 0};
+    uninitialized_relocate_n(overlap, 5, overlap + 2);
+    ASSERT_EQ(std::vector<int>(overlap + 2, overlap + 7), (std::vector<int>{1, 2, 3, 4, 5}));
+    uninitialized_relocate_n(overlap + 2, 5, overlap);
+    ASSERT_EQ(std::vector<int>(overlap, overlap + 5), (std::vector<int>{1, 2, 3, 4, 5}));
+
+    ASSERT_EQ(uninitialized_relocate_n(source, 0, dest), dest);
+    static_assert(noexcept(relocate(source, source + 1, dest)));
+}
+
+TEST_F(RelocateTest, relocate_hooked_type_test)
+{
+    raw_buffer<TrackedRelocatable> source(4);
+    raw_buffer<TrackedRelocatable> dest(4);
+    for (int index = 0; index < 4; ++index)
+    {
+        ::new (source.data() + index) TrackedRelocatable(index);
+    }
+    ASSERT_EQ(Tracked::live, 4);
+
+    relocate(source.data(), source.data() + 4, dest.data());
+    ASSERT_EQ(Tracked::moves, 0);
+    ASSERT_EQ(Tracked::live, 4);
+    for (int index = 0; index < 4; ++index)
+    {
+        ASSERT_EQ(dest.data()[index].value, index);
+        dest.data()[index].~TrackedRelocatable();
+    }
+    ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST_F(RelocateTest, relocate_move_and_destroy_test)
+{
+    raw_buffer<Tracked> buffer(7);
+    for (int index = 0; index < 5; ++index)
+    {
+        ::new (buffer.data() + index) Tracked(index);
+    }
+
+    // overlapping move to higher addresses: back to front
+    uninitialized_relocate_n(buffer.data(), 5, buffer.data() + 2);
+    ASSERT_EQ(Tracked::moves, 5);
+    ASSERT_EQ(Tracked::live, 5);
+    for (int index = 0; index < 5; ++index)
+    {
+        ASSERT_EQ(buffer.data()[index + 2].value, index);
+    }
+
+    // overlapping move to lower addresses: front to back
+    relocate_at(buffer.data() + 2, buffer.data() + 1);
+    uninitialized_relocate_n(buffer.data() + 3, 4, buffer.data() + 2);
+    ASSERT_EQ(Tracked::live, 5);
+    for (int index = 0; index < 5; ++index)
+    {
+        ASSERT_EQ(buffer.data()[index + 1].value, index);
+        buffer.data()[index + 1].~Tracked();
+    }
+    ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST_F(RelocateTest, relocate_throwing_move_test)
+{
+    raw_buffer<Tracked> source(5);
+    raw_buffer<Tracked> dest(5);
+    for (int index = 0; index < 5; ++index)
+    {
+        ::new (source.data() + index) Tracked(index);
+    }
+    static_assert(!noexcept(uninitialized_relocate_n(source.data(), 5, dest.data())));
+
+    Tracked::throw_at = 2;
+    ASSERT_THROW(uninitialized_relocate_n(source.data(), 5, dest.data()), std::runtime_error);
+    // neither range holds live objects after the exception
+    ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST_F(RelocateTest, relocate_derived_with_non_relocatable_member_test)
+{
+    raw_buffer<DerivedComposed> source(1);
+    raw_buffer<DerivedComposed> dest(1);
+    ::new (source.data()) DerivedComposed{{std::make_unique<int>(1), 1}, "short"};
+
+    // the inherited opt-in does not apply, so the short string is move-constructed rather than copied bytewise
+    relocate_at(source.data(), dest.data());
+    ASSERT_EQ(*dest.data()->data, 1);
+    ASSERT_EQ(dest.data()->name, "short");
+    dest.data()->~DerivedComposed();
+}
@@ -0,0 +1,330 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/simd_scan_tests.cc
+ * Description: tests for the vectorised character scans.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "simd_scan.h"
+#include "traits.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+using namespace util;
+
+class SimdScanTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    /**
+     * @brief Instruction sets that can be exercised on this machine.
+     */
+    static vector<simd::isa> supported_isas()
+    {
+        vector<simd::isa> isas{simd::isa::scalar};
+        for (auto kernel : {simd::isa::sse2, simd::isa::avx2, simd::isa::avx512})
+        {
+            if (kernel <= simd::detected_isa())
+            {
+                isas.push_back(kernel);
+            }
+        }
+        return isas;
+    }
+
+    /**
+     * @brief Compare every kernel against char_traits for all lengths and start offsets up to a few vector blocks.
+     */
+    template <typename CharT> static void check_all_kernels()
+    {
+        constexpr size_t max_len = 200;
+        vector<CharT>    buffer(max_len + 64 + 1, CharT{'x'});
+        for (auto kernel : supported_isas())
+        {
+            for (size_t offset = 0; offset < 64 / sizeof(CharT); ++offset)
+            {
+                for (size_t len = 0; len < max_len; ++len)
+                {
+                    CharT* str = buffer.data() + offset;
+                    str[len]   = CharT{};
+                    ASSERT_EQ(simd::terminator_scan(str, ~size_t{0}, kernel), char_traits<CharT>::length(str))
+                        << "isa=" << static_cast<int>(kernel) << " offset=" << offset << " len=" << len;
+
+                    // the limit caps the result
+                    size_t const limit = len / 2;
+                    ASSERT_EQ(simd::terminator_scan(str, limit, kernel), limit);
+                    ASSERT_EQ(simd::terminator_scan(str, len + 1, kernel), len);
+                    str[len] = CharT{'x'};
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Compare every prefix kernel against the scalar one for all sizes and positions of the first unit at or
+     * above the bound, reading nothing past the given size.
+     */
+    template <typename CharT> static void check_all_prefix_kernels(std::uint32_t bound)
+    {
+        constexpr size_t max_len = 150;
+        for (auto kernel : supported_isas())
+        {
+            for (size_t size = 0; size < max_len; ++size)
+            {
+                // exact-size heap buffer: ASan reports any read past it
+                vector<CharT> buffer(size, static_cast<CharT>(bound - 1));
+                ASSERT_EQ(simd::leading_below(buffer.data(), size, bound, kernel), size);
+                for (size_t stop = 0; stop < size; ++stop)
+                {
+                    buffer[stop] = static_cast<CharT>(bound + stop % 3);
+                    ASSERT_EQ(simd::leading_below(buffer.data(), size, bound, kernel), stop)
+                        << "isa=" << static_cast<int>(kernel) << " size=" << size << " stop=" << stop;
+                    buffer[stop] = CharT{};
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Compare every prefix kernel against the scalar one for bounds at the ends of the range of a code unit and
+     * beyond it, over units of all values.
+     */
+    template <typename CharT> static void check_prefix_kernel_bounds()
+    {
+        using unit_type = make_unsigned_t<CharT>;
+
+        std::uint32_t const unit_max = numeric_limits<unit_type>::max();
+        vector<CharT>       buffer(150);
+        for (size_t index = 0; index < buffer.size(); ++index)
+        {
+            buffer[index] = static_cast<CharT>(index * 0x1'0101U);
+        }
+        buffer.back() = static_cast<CharT>(unit_max);
+        for (std::uint32_t bound : {0U, 1U, unit_max, unit_max + 1U, 0x100U, 0x1'0000U, 0xFFFF'FFFFU})
+        {
+            size_t const expected = simd::leading_below(buffer.data(), buffer.size(), bound, simd::isa::scalar);
+            for (auto kernel : supported_isas())
+            {
+                ASSERT_EQ(simd::leading_below(buffer.data(), buffer.size(), bound, kernel), expected)
+                    << "isa=" << static_cast<int>(kernel) << " bound=" << bound;
+            }
+            ASSERT_EQ(simd::leading_below(buffer.data(), buffer.size(), bound), expected) << "bound=" << bound;
+            if (bound > unit_max)
+            {
+                ASSERT_EQ(expected, buffer.size());
+            }
+        }
+    }
+
+    /**
+     * @brief Compare every mismatch kernel against the scalar one for all sizes and positions of the first difference.
+     */
+    template <typename CharT> static void check_all_mismatch_kernels()
+    {
+        constexpr size_t max_len = 150;
+        for (auto kernel : supported_isas())
+        {
+            for (size_t size = 0; size < max_len; ++size)
+            {
+                vector<CharT> lhs(size, CharT{'a'});
+                vector<CharT> rhs(size, CharT{'a'});
+                ASSERT_EQ(simd::first_mismatch(lhs.data(), rhs.data(), size, kernel), size);
+                for (size_t diff = 0; diff < size; ++diff)
+                {
+                    // differ in the most significant byte only, so that byte-wise kernels must map back to the unit
+                    rhs[diff] = static_cast<CharT>(CharT{'a'} ^ (CharT{1} << (8 * sizeof(CharT) - 2)));
+                    ASSERT_EQ(simd::first_mismatch(lhs.data(), rhs.data(), size, kernel), diff)
+                        << "isa=" << static_cast<int>(kernel) << " size=" << size << " diff=" << diff;
+                    rhs[diff] = CharT{'a'};
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SimdScanTest, first_mismatch_test)
+{
+    check_all_mismatch_kernels<char>();
+    check_all_mismatch_kernels<char16_t>();
+    check_all_mismatch_kernels<wchar_t>();
+    check_all_mismatch_kernels<char32_t>();
+
+    ASSERT_EQ(simd::first_mismatch(u"abcd", u"abxd", 4), 2UL);
+    ASSERT_EQ(simd::first_mismatch(U"abcd", U"abcd", 4), 4UL);
+}
+
+TEST_F(SimdScanTest, leading_below_test)
+{
+    check_all_prefix_kernels<char>(0x80);
+    check_all_prefix_kernels<char16_t>(0x80);
+    check_all_prefix_kernels<char16_t>(0xD800);
+    check_all_prefix_kernels<wchar_t>(0x80);
+    check_all_prefix_kernels<char32_t>(0xD800);
+
+    check_prefix_kernel_bounds<char>();
+    check_prefix_kernel_bounds<char16_t>();
+    check_prefix_kernel_bounds<wchar_t>();
+    check_prefix_kernel_bounds<char32_t>();
+
+    ASSERT_EQ(simd::leading_below("abc\xC3\xBC", 5, 0x80), 3UL);
+    ASSERT_EQ(simd::leading_below(u"ab\xD83D", 3, 0xD800), 2UL);
+    ASSERT_EQ(simd::leading_below(U"", 0, 0x80), 0UL);
+}
+
+TEST_F(SimdScanTest, terminator_scan_char_test)
+{
+    check_all_kernels<char>();
+}
+
+TEST_F(SimdScanTest, terminator_scan_wchar_test)
+{
+    check_all_kernels<wchar_t>();
+}
+
+TEST_F(SimdScanTest, terminator_scan_char16_test)
+{
+    check_all_kernels<char16_t>();
+}
+
+TEST_F(SimdScanTest, terminator_scan_char32_test)
+{
+    check_all_kernels<char32_t>();
+}
+
+TEST_F(SimdScanTest, terminator_scan_dispatch_test)
+{
+    ASSERT_LE(simd::active_isa(), simd::detected_isa());
+    ASSERT_EQ(simd::terminator_scan("hello"), 5UL);
+    ASSERT_EQ(simd::terminator_scan(L"hello"), 5UL);
+    ASSERT_EQ(simd::terminator_scan(u"hello"), 5UL);
+    ASSERT_EQ(simd::terminator_scan(U"hello"), 5UL);
+    ASSERT_EQ(simd::terminator_scan(U""), 0UL);
+    ASSERT_EQ(simd::terminator_scan("hello", 0), 0UL);
+}
+
+#if defined(__linux__)
+TEST_F(SimdScanTest, terminator_scan_page_end_test)
+{
+    // strings ending right before an inaccessible page must not fault
+    auto const page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void*      mem  = mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mem, MAP_FAILED);
+    ASSERT_EQ(mprotect(static_cast<char*>(mem) + page, page, PROT_NONE), 0);
+
+    auto* end = reinterpret_cast<char32_t*>(static_cast<char*>(mem) + page);
+    for (size_t len = 0; len < 40; ++len)
+    {
+        char32_t* str = end - len - 1;
+        for (size_t i = 0; i < len; ++i)
+        {
+            str[i] = U'a';
+        }
+        str[len] = U'\0';
+        for (auto kernel : supported_isas())
+        {
+            ASSERT_EQ(simd::terminator_scan(str, ~size_t{0}, kernel), len);
+        }
+    }
+
+    // a bounded scan stops at the limit even without terminator
+    auto* bytes = static_cast<char*>(mem) + page - 7;
+    for (size_t i = 0; i < 7; ++i)
+    {
+        bytes[i] = 'z';
+    }
+    for (auto kernel : supported_isas())
+    {
+        ASSERT_EQ(simd::terminator_scan(bytes, 7, kernel), 7UL);
+    }
+
+    munmap(mem, 2 * page);
+}
+#endif
+
+TEST_F(SimdScanTest, static_extent_test)
+{
+    ASSERT_EQ((static_extent_v<char[4]>), 4UL);
+    ASSERT_EQ((static_extent_v<char const[6]>), 6UL);
+    ASSERT_EQ((static_extent_v<char32_t const[1]>), 1UL);
+    ASSERT_EQ((static_extent_v<wchar_t>), 1UL);
+    ASSERT_EQ((static_extent_v<char[]>), dynamic_extent);
+    ASSERT_EQ((static_extent_v<char const*>), dynamic_extent);
+    ASSERT_EQ((static_extent_v<std::string>), dynamic_extent);
+    ASSERT_EQ((static_extent_v<int[4]>), dynamic_extent);
+    ASSERT_EQ((static_extent_v<int>), dynamic_extent);
+    ASSERT_EQ(static_extent_v<std::remove_reference_t<decltype("abc")>>, 4UL);
+
+    // the bound is the size of an array without terminator
+    constexpr char unterminated[4] = {'a', 'b', 'c', 'd'};
+    static_assert(string_or_char_size(unterminated) == static_extent_v<std::remove_cvref_t<decltype(unterminated)>>);
+    char mutable_unterminated[4] = {'a', 'b', 'c', 'd'};
+    ASSERT_EQ(string_or_char_size(mutable_unterminated), static_extent_v<decltype(mutable_unterminated)>);
+    ASSERT_LE(string_or_char_size("abc"), static_extent_v<std::remove_reference_t<decltype("abc")>>);
+}
+
+TEST_F(SimdScanTest, string_or_char_size_constexpr_test)
+{
+    static_assert(string_or_char_size("abc") == 3);
+    static_assert(string_or_char_size(u"") == 0);
+    static_assert(string_or_char_size(U"wide") == 4);
+    static_assert(string_or_char_size('a') == 1);
+    static_assert(string_or_char_size(42) == 0);
+
+    constexpr char const* ptr = "pointer";
+    static_assert(string_or_char_size(ptr) == 7);
+
+    // the bound is honoured: no terminator means the full array
+    constexpr char unterminated[3] = {'a', 'b', 'c'};
+    static_assert(string_or_char_size(unterminated) == 3);
+    constexpr char16_t embedded[8] = u"ab\0cd";
+    static_assert(string_or_char_size(embedded) == 2);
+}
+
+TEST_F(SimdScanTest, string_or_char_size_runtime_bounded_test)
+{
+    char unterminated[5] = {'a', 'b', 'c', 'd', 'e'};
+    ASSERT_EQ(string_or_char_size(unterminated), 5UL);
+
+    char32_t buffer[64] = U"short";
+    ASSERT_EQ(string_or_char_size(buffer), 5UL);
+
+    std::u16string long_string(1'000, u'q');
+    ASSERT_EQ(string_or_char_size(long_string.c_str()), 1'000UL);
+    ASSERT_EQ(string_or_char_size(static_cast<char16_t const*>(long_string.c_str()) + 3), 997UL);
+}
@@ -0,0 +1,140 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/string_compare_tests.cc
+ * Description: tests for the transparent string comparators.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_compare.h"
+
+#include <compare>
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class StringCompareTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    /**
+     * @brief string_compare orders like std::basic_string::compare for strings that differ in any position, in the
+     * most or least significant byte of a code unit, and in length.
+     */
+    template <typename CharT> static void check_like_std_compare()
+    {
+        vector<CharT> const units{CharT{'a'},
+                                  CharT{'b'},
+                                  static_cast<CharT>(~CharT{0}),
+                                  static_cast<CharT>(CharT{'a'} ^ (CharT{1} << (8 * sizeof(CharT) - 2)))};
+        for (size_t size = 0; size < 80; size += 3)
+        {
+            basic_string<CharT> const base(size, CharT{'a'});
+            for (size_t position = 0; position < size; ++position)
+            {
+                for (CharT unit : units)
+                {
+                    basic_string<CharT> other = base;
+                    other[position]           = unit;
+                    int const expected        = base.compare(other);
+                    auto const ordering       = string_compare{}(base, other);
+                    ASSERT_EQ(ordering < 0, expected < 0) << "size=" << size << " position=" << position;
+                    ASSERT_EQ(ordering == 0, expected == 0);
+                    ASSERT_EQ(string_compare{}(other, base), 0 <=> expected);
+                }
+            }
+            ASSERT_EQ(string_compare{}(base, base + CharT{'a'}), strong_ordering::less);
+            ASSERT_EQ(string_compare{}(base + CharT{'a'}, base), strong_ordering::greater);
+        }
+    }
+};
+
+TEST_F(StringCompareTest, string_compare_test)
+{
+    string_compare const compare;
+    std::string const    abc = "abc";
+
+    ASSERT_EQ(compare(abc, "abc"), strong_ordering::equal);
+    ASSERT_EQ(compare("abc", std::string_view("abd")), strong_ordering::less);
+    ASSERT_EQ(compare(abc, "ab"), strong_ordering::greater);
+    ASSERT_EQ(compare("", std::string{}), strong_ordering::equal);
+    ASSERT_EQ(compare(u"b", u'a'), strong_ordering::greater);
+    ASSERT_EQ(compare(U'a', U"ab"), strong_ordering::less);
+    ASSERT_EQ(compare(L'x', std::wstring(L"x")), strong_ordering::equal);
+    static_assert(string_compare{}(u"abc", u"abd") == strong_ordering::less);
+    static_assert(string_compare{}("b", 'a') == strong_ordering::greater);
+
+    ASSERT_TRUE((std::is_invocable_v<string_compare const&, std::string, char const*>));
+    ASSERT_TRUE((std::is_invocable_v<string_compare const&, char, std::string>));
+    ASSERT_FALSE((std::is_invocable_v<string_compare const&, std::string, wchar_t>));
+    ASSERT_FALSE((std::is_invocable_v<string_compare const&, std::u16string, std::u32string>));
+    ASSERT_FALSE((std::is_invocable_v<string_compare const&, char, char>));
+}
+
+TEST_F(StringCompareTest, string_compare_like_std_test)
+{
+    check_like_std_compare<char>();
+    check_like_std_compare<wchar_t>();
+    check_like_std_compare<char16_t>();
+    check_like_std_compare<char32_t>();
+}
+
+TEST_F(StringCompareTest, string_less_test)
+{
+    string_less const less;
+    ASSERT_TRUE(less("abc", std::string("abd")));
+    ASSERT_FALSE(less(std::string("abc"), "abc"));
+    ASSERT_TRUE(less('a', "b"));
+    ASSERT_TRUE(less(std::u16string_view(u"ab"), u"abc"));
+}
+
+TEST_F(StringCompareTest, ordered_container_lookup_test)
+{
+    std::map<std::string, int, string_less> map{{"alpha", 1}, {"beta", 2}, {"gamma", 3}};
+
+    char const*      pointer = "beta";
+    std::string_view view    = "gamma";
+    ASSERT_EQ(map.find("alpha")->second, 1);
+    ASSERT_EQ(map.find(pointer)->second, 2);
+    ASSERT_EQ(map.find(view)->second, 3);
+    ASSERT_EQ(map.find("delta"), map.end());
+    ASSERT_EQ(map.lower_bound("b")->first, "beta");
+    ASSERT_EQ(map.upper_bound('c')->first, "gamma");
+
+    std::set<std::u32string, string_less> set{U"one", U"two"};
+    ASSERT_TRUE(set.contains(U"one"));
+    ASSERT_TRUE(set.contains(std::u32string_view(U"two")));
+    ASSERT_FALSE(set.contains(U"three"));
+}
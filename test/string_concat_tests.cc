@@ -0,0 +1,160 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/string_concat_tests.cc
+ * Description: tests for single-allocation string concatenation.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_concat.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace util;
+
+class StringConcatTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(StringConcatTest, concat_operand_test)
+{
+    ASSERT_TRUE((concat_operand_of<std::string, char>));
+    ASSERT_TRUE((concat_operand_of<std::string_view const&, char>));
+    ASSERT_TRUE((concat_operand_of<char const*, char>));
+    ASSERT_TRUE((concat_operand_of<char[4], char>));
+    ASSERT_TRUE((concat_operand_of<char, char>));
+    ASSERT_TRUE((concat_operand_of<char16_t, char16_t>));
+    ASSERT_TRUE((concat_operand_of<std::u32string_view, char32_t>));
+
+    ASSERT_FALSE((concat_operand_of<wchar_t, char>));
+    ASSERT_FALSE((concat_operand_of<std::wstring, char>));
+    ASSERT_FALSE((concat_operand_of<int, char>));
+
+    ASSERT_TRUE((std::is_same_v<string_or_char_type_t<char16_t const*>, char16_t>));
+    ASSERT_TRUE((std::is_same_v<string_or_char_type_t<wchar_t const&>, wchar_t>));
+}
+
+TEST_F(StringConcatTest, concat_test)
+{
+    std::string      prefix = "user";
+    std::string_view id     = "42";
+    char const*      slash  = "/";
+    char             tail[] = "profile";
+
+    ASSERT_EQ(concat(prefix, ':', id, slash, tail), "user:42/profile");
+    ASSERT_EQ(concat("only"), "only");
+    ASSERT_EQ(concat('x'), "x");
+    ASSERT_EQ(concat(std::string{}, "", std::string_view{}), "");
+    ASSERT_EQ(concat(u"wide", u'-', std::u16string(u"string")), u"wide-string");
+    ASSERT_EQ(concat(U'a', U"bc", std::u32string_view(U"de")), U"abcde");
+
+    auto const result = concat(prefix, id);
+    ASSERT_TRUE((std::is_same_v<std::remove_const_t<decltype(result)>, std::string>));
+}
+
+TEST_F(StringConcatTest, concat_single_allocation_test)
+{
+    std::string const long_a(100, 'a');
+    std::string const long_b(200, 'b');
+
+    auto const result = concat(long_a, '-', long_b, "-", std::string_view(long_a));
+    ASSERT_EQ(result.size(), 100UL + 1UL + 200UL + 1UL + 100UL);
+    ASSERT_EQ(result, long_a + "-" + long_b + "-" + long_a);
+}
+
+TEST_F(StringConcatTest, append_to_test)
+{
+    std::string out = "key=";
+    append_to(out, "abc", '_', std::string("def"), std::string_view("ghi"));
+    ASSERT_EQ(out, "key=abc_defghi");
+
+    append_to(out);
+    ASSERT_EQ(out, "key=abc_defghi");
+
+    std::wstring wide = L"x";
+    append_to(wide, L'y', L"z");
+    ASSERT_EQ(wide, L"xyz");
+
+    // appending to a reserved buffer does not reallocate
+    std::string buffer;
+    buffer.reserve(64);
+    auto const* data = buffer.data();
+    append_to(buffer, "0123456789", ':', std::string_view("abcdef"));
+    ASSERT_EQ(buffer.data(), data);
+    ASSERT_EQ(buffer, "0123456789:abcdef");
+}
+
+TEST_F(StringConcatTest, append_to_self_test)
+{
+    // pieces pointing into out stay valid while out grows
+    std::string out(40, 'x');
+    out.shrink_to_fit();
+    std::string const expected = out + out + out;
+    append_to(out, out, out.c_str());
+    ASSERT_EQ(out, expected);
+
+    std::string      text = "0123456789";
+    std::string_view tail = std::string_view{text}.substr(6);
+    append_to(text, ':', tail, text.data() + 8);
+    ASSERT_EQ(text, "0123456789:678989");
+
+    std::string line = "abc";
+    auto const  expr = lazy_concat(line) + '-' + line;
+    expr.append_to(line);
+    ASSERT_EQ(line, "abcabc-abc");
+}
+
+TEST_F(StringConcatTest, lazy_concat_test)
+{
+    std::string const prefix = "user";
+    std::string_view  id     = "42";
+
+    std::string key = lazy_concat(prefix) + ':' + id + "/" + std::string("profile");
+    ASSERT_EQ(key, "user:42/profile");
+
+    auto const expr = lazy_concat(prefix, ':') + id;
+    ASSERT_EQ(expr.size(), 7UL);
+    ASSERT_EQ(expr.str(), "user:42");
+
+    std::string out = ">";
+    expr.append_to(out);
+    ASSERT_EQ(out, ">user:42");
+
+    std::u16string wide = lazy_concat(u'[') + u"wide" + u']';
+    ASSERT_EQ(wide, u"[wide]");
+}
+
+TEST_F(StringConcatTest, concat_constexpr_test)
+{
+    static_assert(concat("ab", 'c', std::string_view("de")).size() == 5);
+    static_assert((lazy_concat("ab") + 'c' + "de").str() == std::string_view("abcde"));
+}
@@ -0,0 +1,123 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/string_hash_tests.cc
+ * Description: tests for the transparent string hash and equality functors.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_hash.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace std;
+using namespace util;
+
+class StringHashTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(StringHashTest, as_string_view_test)
+{
+    char           array[] = "array";
+    char const*    pointer = "pointer";
+    std::wstring   wide    = L"wide";
+    char16_t const bounded[4]{u'a', u'b', u'c', u'd'};
+
+    ASSERT_EQ(as_string_view(array), "array");
+    ASSERT_EQ(as_string_view(pointer), "pointer");
+    ASSERT_EQ(as_string_view(wide), L"wide");
+    ASSERT_EQ(as_string_view(std::string_view("view")), "view");
+    ASSERT_EQ(as_string_view(bounded), u"abcd");
+    static_assert(as_string_view("constexpr").size() == 9);
+}
+
+TEST_F(StringHashTest, string_hash_test)
+{
+    string_hash const hash;
+    std::string const key = "a key long enough to defeat the small string buffer";
+    char const*       ptr = key.c_str();
+
+    ASSERT_EQ(hash(key), std::hash<std::string>{}(key));
+    ASSERT_EQ(hash(ptr), hash(key));
+    ASSERT_EQ(hash(std::string_view(key)), hash(key));
+    ASSERT_EQ(hash("abc"), hash(std::string("abc")));
+    ASSERT_EQ(hash(L"abc"), std::hash<std::wstring>{}(L"abc"));
+    ASSERT_EQ(hash(U"abc"), hash(std::u32string_view(U"abc")));
+    ASSERT_NE(hash("abc"), hash("abd"));
+
+    ASSERT_TRUE((std::is_invocable_v<string_hash const&, char const*>));
+    ASSERT_TRUE((std::is_invocable_v<string_hash const&, std::u16string>));
+    ASSERT_FALSE((std::is_invocable_v<string_hash const&, int>));
+    ASSERT_FALSE((std::is_invocable_v<string_hash const&, char>));
+}
+
+TEST_F(StringHashTest, string_equal_test)
+{
+    string_equal const equal;
+    std::string const  key = "abc";
+
+    ASSERT_TRUE(equal(key, "abc"));
+    ASSERT_TRUE(equal("abc", key));
+    ASSERT_TRUE(equal(std::string_view("abc"), key.c_str()));
+    ASSERT_FALSE(equal(key, "ab"));
+    ASSERT_FALSE(equal(key, "abcd"));
+    ASSERT_TRUE(equal(L"x", std::wstring(L"x")));
+    static_assert(string_equal{}("abc", std::string_view("abc")));
+
+    ASSERT_TRUE((std::is_invocable_v<string_equal const&, std::string, char const*>));
+    ASSERT_FALSE((std::is_invocable_v<string_equal const&, std::string, wchar_t const*>));
+    ASSERT_FALSE((std::is_invocable_v<string_equal const&, std::string, char>));
+}
+
+TEST_F(StringHashTest, heterogeneous_lookup_test)
+{
+    std::unordered_map<std::string, int, string_hash, string_equal> map{{"one", 1}, {"two", 2}};
+
+    char const*      pointer = "one";
+    std::string_view view    = "two";
+    char             array[] = "one";
+
+    ASSERT_EQ(map.find(pointer)->second, 1);
+    ASSERT_EQ(map.find(view)->second, 2);
+    ASSERT_EQ(map.find(array)->second, 1);
+    ASSERT_EQ(map.find("three"), map.end());
+    ASSERT_TRUE(map.contains(std::string_view("one")));
+    ASSERT_EQ(map.count("two"), 1UL);
+
+    std::unordered_set<std::u16string, string_hash, string_equal> set{u"alpha", u"beta"};
+    ASSERT_TRUE(set.contains(u"alpha"));
+    ASSERT_TRUE(set.contains(std::u16string_view(u"beta")));
+    ASSERT_FALSE(set.contains(u"gamma"));
+}
@@ -0,0 +1,174 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/string_sso_tests.cc
+ * Description: tests for sso_capacity and fits_inline.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_sso.h"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+size_t allocations = 0;
+
+/**
+ * @brief std::allocator that counts its allocations.
+ */
+template <typename T> struct CountingAllocator : std::allocator<T>
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <typename U> CountingAllocator(CountingAllocator<U> const&) noexcept
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(count);
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept
+    {
+        std::allocator<T>::deallocate(pointer, count);
+    }
+
+    template <typename U> struct rebind
+    {
+        using other = CountingAllocator<U>;
+    };
+};
+
+template <typename CharT>
+using counted_string = std::basic_string<CharT, std::char_traits<CharT>, CountingAllocator<CharT>>;
+
+/**
+ * @brief Whether constructing a counted_string of the given length allocates.
+ */
+template <typename CharT> bool allocates(size_t length)
+{
+    allocations = 0;
+    counted_string<CharT> const str(length, CharT{'x'});
+    return allocations > 0;
+}
+
+/**
+ * @brief Whether fits_inline accepts a string-like of type T for the target String.
+ */
+template <typename String, typename T>
+concept can_fit_inline = requires(T const& str) { fits_inline<String>(str); };
+} // namespace
+
+class StringSsoTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(StringSsoTest, sso_capacity_test)
+{
+    ASSERT_EQ(sso_capacity_v<std::string>, std::string().capacity());
+    ASSERT_EQ(sso_capacity_v<std::wstring>, std::wstring().capacity());
+    ASSERT_EQ(sso_capacity_v<std::u16string>, std::u16string().capacity());
+    ASSERT_EQ(sso_capacity_v<std::u32string>, std::u32string().capacity());
+    ASSERT_EQ(sso_capacity_v<std::pmr::string>, std::pmr::string().capacity());
+    ASSERT_EQ(sso_capacity_v<counted_string<char>>, counted_string<char>().capacity());
+    ASSERT_EQ(sso_capacity_v<counted_string<char32_t>>, counted_string<char32_t>().capacity());
+    ASSERT_EQ(sso_capacity_v<std::string const>, sso_capacity_v<std::string>);
+    ASSERT_EQ(sso_capacity_v<counted_string<char> const volatile>, sso_capacity_v<counted_string<char>>);
+    ASSERT_EQ(has_constant_sso_capacity_v<std::string const>, has_constant_sso_capacity_v<std::string>);
+
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(_MSVC_STL_VERSION)
+    static_assert(has_constant_sso_capacity_v<std::string>);
+    static_assert(has_constant_sso_capacity_v<std::string const>);
+    static_assert(sso_capacity_v<std::string> >= 15);
+    static_assert(sso_capacity_v<std::string const> == sso_capacity_v<std::string>);
+    static_assert(sso_capacity_v<std::u32string> >= 3);
+#endif
+#if defined(__GLIBCXX__) && _GLIBCXX_USE_CXX11_ABI
+    static_assert(sso_capacity_v<std::string> == 15);
+    static_assert(sso_capacity_v<std::u16string> == 7);
+    static_assert(has_constant_sso_capacity_v<counted_string<char>>);
+#endif
+
+    // the capacity is exactly the longest string stored without allocating
+    ASSERT_FALSE(allocates<char>(sso_capacity_v<counted_string<char>>));
+    ASSERT_TRUE(allocates<char>(sso_capacity_v<counted_string<char>> + 1));
+    ASSERT_FALSE(allocates<char16_t>(sso_capacity_v<counted_string<char16_t>>));
+    ASSERT_TRUE(allocates<char16_t>(sso_capacity_v<counted_string<char16_t>> + 1));
+}
+
+TEST_F(StringSsoTest, fits_inline_test)
+{
+    std::string const short_key(sso_capacity_v<std::string>, 'k');
+    std::string const long_key(sso_capacity_v<std::string> + 1, 'k');
+
+    ASSERT_TRUE(fits_inline(short_key));
+    ASSERT_FALSE(fits_inline(long_key));
+    ASSERT_TRUE(fits_inline(std::string_view(short_key)));
+    ASSERT_FALSE(fits_inline(std::string_view(long_key)));
+    ASSERT_TRUE(fits_inline(short_key.c_str()));
+    ASSERT_FALSE(fits_inline(long_key.c_str()));
+    ASSERT_TRUE(fits_inline("key"));
+    ASSERT_TRUE(fits_inline(""));
+    ASSERT_TRUE(fits_inline(U"key"));
+
+    // against another string type
+    std::u16string const text(sso_capacity_v<std::u16string>, u'x');
+    ASSERT_TRUE(fits_inline(text));
+    ASSERT_TRUE(fits_inline<counted_string<char16_t>>(text));
+    ASSERT_TRUE(fits_inline<std::string>("key"));
+    ASSERT_TRUE(fits_inline<std::string const>("key"));
+    ASSERT_FALSE(fits_inline<std::string const>(long_key));
+
+    // only against a string type of the same character type
+    ASSERT_TRUE((can_fit_inline<std::wstring, wchar_t const*>));
+    ASSERT_FALSE((can_fit_inline<std::wstring, char const*>));
+    ASSERT_FALSE((can_fit_inline<std::string, std::u16string>));
+    ASSERT_FALSE((can_fit_inline<std::vector<char>, std::string>));
+
+    // agrees with the allocations actually made
+    for (size_t length = 0; length < 40; ++length)
+    {
+        std::string const key(length, 'k');
+        ASSERT_EQ(fits_inline<counted_string<char>>(key), !allocates<char>(length)) << length;
+    }
+}
@@ -0,0 +1,183 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/string_switch_tests.cc
+ * Description: tests for string_switch.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "string_switch.h"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+using verbs = string_switch<"GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH">;
+
+/**
+ * @brief Key "k" followed by the four decimal digits of Index.
+ */
+template <size_t Index> constexpr fixed_string<5> numbered_key = []
+{
+    fixed_string<5> key;
+    key.chars[0] = 'k';
+    for (size_t digit = 0, rest = Index; digit < 4; ++digit, rest /= 10)
+    {
+        key.chars[4 - digit] = static_cast<char>('0' + rest % 10);
+    }
+    return key;
+}();
+
+template <size_t... Indices> auto make_numbered_switch(std::index_sequence<Indices...>)
+{
+    return string_switch<numbered_key<Indices>...>{};
+}
+
+std::string numbered(size_t index)
+{
+    std::string const digits = std::to_string(index);
+    return "k" + std::string(4 - digits.size(), '0') + digits;
+}
+} // namespace
+
+class StringSwitchTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(StringSwitchTest, index_test)
+{
+    static_assert(verbs::size == 9);
+    static_assert(verbs::npos == 9);
+    static_assert(verbs::index<"GET"> == 0);
+    static_assert(verbs::index<"POST"> == 2);
+    static_assert(verbs::index<"PATCH"> == 8);
+
+    ASSERT_EQ(verbs::index<"DELETE">, 4UL);
+    ASSERT_EQ(verbs::index<"TRACE">, 7UL);
+}
+
+TEST_F(StringSwitchTest, index_of_test)
+{
+    std::string const names[] = {"GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH"};
+    for (size_t index = 0; index < std::size(names); ++index)
+    {
+        ASSERT_EQ(verbs::index_of(names[index]), index);
+    }
+    static_assert(verbs::index_of("PUT") == 3);
+
+    ASSERT_EQ(verbs::index_of("get"), verbs::npos);
+    ASSERT_EQ(verbs::index_of("GE"), verbs::npos);
+    ASSERT_EQ(verbs::index_of("GETS"), verbs::npos);
+    ASSERT_EQ(verbs::index_of(""), verbs::npos);
+    ASSERT_EQ(verbs::index_of("NOPE"), verbs::npos);
+}
+
+TEST_F(StringSwitchTest, argument_types_test)
+{
+    std::string const request = "POST /index.html HTTP/1.1";
+    std::string_view  method  = std::string_view(request).substr(0, request.find(' '));
+    char const*       pointer = "HEAD";
+    char              array[] = "PATCH";
+
+    ASSERT_EQ(verbs::index_of(method), verbs::index<"POST">);
+    ASSERT_EQ(verbs::index_of(pointer), verbs::index<"HEAD">);
+    ASSERT_EQ(verbs::index_of(array), verbs::index<"PATCH">);
+    ASSERT_EQ(verbs::index_of(fixed_string("OPTIONS")), verbs::index<"OPTIONS">);
+    ASSERT_EQ(verbs{}(std::string("CONNECT")), verbs::index<"CONNECT">);
+
+    ASSERT_FALSE((std::is_invocable_v<verbs const&, std::wstring>));
+    ASSERT_FALSE((std::is_invocable_v<verbs const&, int>));
+}
+
+TEST_F(StringSwitchTest, switch_statement_test)
+{
+    auto const handler = [](std::string_view method) -> std::string_view
+    {
+        switch (verbs::index_of(method))
+        {
+            case verbs::index<"GET">:
+            case verbs::index<"HEAD">:
+                return "read";
+            case verbs::index<"POST">:
+            case verbs::index<"PUT">:
+            case verbs::index<"PATCH">:
+                return "write";
+            case verbs::npos:
+                return "bad request";
+            default:
+                return "other";
+        }
+    };
+
+    ASSERT_EQ(handler("HEAD"), "read");
+    ASSERT_EQ(handler("PATCH"), "write");
+    ASSERT_EQ(handler("TRACE"), "other");
+    ASSERT_EQ(handler("BREW"), "bad request");
+}
+
+TEST_F(StringSwitchTest, edge_cases_test)
+{
+    using none = string_switch<>;
+    static_assert(none::size == 0);
+    ASSERT_EQ(none::index_of("anything"), none::npos);
+
+    using single = string_switch<"only">;
+    ASSERT_EQ(single::index_of("only"), 0UL);
+    ASSERT_EQ(single::index_of("other"), single::npos);
+
+    using with_empty = string_switch<"", "a">;
+    ASSERT_EQ(with_empty::index_of(""), 0UL);
+    ASSERT_EQ(with_empty::index_of("a"), 1UL);
+    ASSERT_EQ(with_empty::index_of("b"), with_empty::npos);
+
+    using wide = string_switch<L"alpha", L"beta">;
+    ASSERT_EQ(wide::index_of(std::wstring(L"beta")), wide::index<L"beta">);
+    ASSERT_EQ(wide::index_of(L"gamma"), wide::npos);
+}
+
+TEST_F(StringSwitchTest, many_keys_test)
+{
+    using numbered_switch = decltype(make_numbered_switch(std::make_index_sequence<300>{}));
+
+    static_assert(numbered_switch::size == 300);
+    static_assert(numbered_switch::index<"k0299"> == 299);
+    for (size_t index = 0; index < numbered_switch::size; ++index)
+    {
+        ASSERT_EQ(numbered_switch::index_of(numbered(index)), index);
+    }
+    ASSERT_EQ(numbered_switch::index_of(numbered(300)), numbered_switch::npos);
+    ASSERT_EQ(numbered_switch::index_of("k029"), numbered_switch::npos);
+}
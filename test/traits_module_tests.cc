@@ -0,0 +1,90 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/traits_module_tests.cc
+ * Description: tests for the dkyb.traits module; only built with TYPETRAITS_BUILD_MODULES.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+import dkyb.traits;
+
+namespace
+{
+struct Record
+{
+    bool valid() const noexcept
+    {
+        return true;
+    }
+
+    static Record make(int)
+    {
+        return {};
+    }
+};
+
+constexpr auto valid_probe = []<typename T>(auto& target) -> decltype(target = &T::valid) { return target; };
+constexpr auto make_probe  = []<typename T>(auto& target) -> decltype(target = &T::make) { return target; };
+} // namespace
+
+class TraitsModuleTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(TraitsModuleTest, exported_traits_test)
+{
+    static_assert(util::is_string_v<std::string>);
+    static_assert(util::is_std_string_view_v<std::wstring_view>);
+    static_assert(util::string_kind_v<char const*> == util::string_kind::char_pointer);
+    static_assert(util::is_compatible_string_v<std::string, char const[4]>);
+    static_assert(util::is_tuple_like_v<std::pair<int, char>>);
+    static_assert(util::is_tuple_c<std::tuple<>>);
+    static_assert(util::is_equality_comparable_v<std::string, char const*>);
+    static_assert(std::is_same_v<util::get_Nth_type_t<1, int, Record>, Record>);
+    static_assert(util::index_of_type_v<Record, int, Record> == 1);
+    static_assert(util::has_std_hash_v<std::string>);
+
+    ASSERT_EQ(util::as_string_view("module"), std::string_view{"module"});
+    ASSERT_EQ(util::string_or_char_size(std::string{"four"}), 4UL);
+    ASSERT_EQ(util::simd::first_mismatch("abcd", "abxd", 4), 2UL);
+}
+
+TEST_F(TraitsModuleTest, member_detection_test)
+{
+    static_assert(util::has_member_function_c<Record, bool() const noexcept, valid_probe>);
+    static_assert(!util::has_member_function_c<Record, bool(), valid_probe>);
+    static_assert(util::has_static_member_function_c<Record, Record(int), make_probe>);
+    static_assert(!util::has_static_member_function_c<int, Record(int), make_probe>);
+}
@@ -25,9 +25,11 @@
 #include "traits.h"
 #include "traits_static.h"
 
+#include <array>
 #include <gtest/gtest.h>
 #include <string>
 #include <tuple>
+#include <utility>
 
 using namespace std;
 using namespace util;
@@ -225,6 +227,47 @@ TEST_F(TraitsTest, is_string_test)
     ASSERT_TRUE(is_string_v<std::basic_string_view<char32_t>>);
 }
 
+TEST_F(TraitsTest, string_classification_test)
+{
+    ASSERT_EQ(string_kind_v<std::string>, string_kind::std_string);
+    ASSERT_EQ(string_kind_v<std::u32string>, string_kind::std_string);
+    ASSERT_EQ(string_kind_v<std::wstring_view>, string_kind::std_string_view);
+    ASSERT_EQ(string_kind_v<char*>, string_kind::char_pointer);
+    ASSERT_EQ(string_kind_v<char16_t const*>, string_kind::char_pointer);
+    ASSERT_EQ(string_kind_v<char*&>, string_kind::char_pointer);
+    ASSERT_EQ(string_kind_v<char const* const>, string_kind::char_pointer);
+    ASSERT_EQ(string_kind_v<wchar_t[]>, string_kind::char_array);
+    ASSERT_EQ(string_kind_v<char const[12]>, string_kind::char_array);
+
+    ASSERT_EQ(string_kind_v<int>, string_kind::none);
+    ASSERT_EQ(string_kind_v<char>, string_kind::none);
+    ASSERT_EQ(string_kind_v<int*>, string_kind::none);
+    ASSERT_EQ(string_kind_v<int[3]>, string_kind::none);
+    ASSERT_EQ(string_kind_v<std::string const>, string_kind::none);
+
+    ASSERT_TRUE((std::is_same_v<string_char_t<std::wstring>, wchar_t>));
+    ASSERT_TRUE((std::is_same_v<string_char_t<std::u16string_view>, char16_t>));
+    ASSERT_TRUE((std::is_same_v<string_char_t<char32_t const*>, char32_t>));
+    ASSERT_TRUE((std::is_same_v<string_char_t<char[8]>, char>));
+    ASSERT_TRUE((std::is_same_v<string_char_t<int*>, void>));
+    ASSERT_TRUE((std::is_same_v<string_char_t<double>, void>));
+
+    // every per-kind trait agrees with the classification
+    ASSERT_TRUE((std::is_same_v<is_std_string<std::string>::char_type, char>));
+    ASSERT_TRUE((std::is_same_v<is_std_string<std::string_view>::char_type, void>));
+    ASSERT_TRUE((std::is_same_v<is_char_pointer<wchar_t*>::char_type, wchar_t>));
+    ASSERT_TRUE((std::is_same_v<is_char_array<char16_t[4]>::char_type, char16_t>));
+    ASSERT_TRUE((std::is_same_v<is_string<char32_t const*>::char_type, char32_t>));
+    ASSERT_EQ(is_string<std::wstring_view>::kind, string_kind::std_string_view);
+    ASSERT_TRUE(is_string<std::wstring_view>::is_std_string_view_val);
+    ASSERT_FALSE(is_string<std::wstring_view>::is_std_string_val);
+
+    // the _t aliases are usable for every kind
+    ASSERT_TRUE((std::is_same_v<is_string_t<char*>, std::true_type>));
+    ASSERT_TRUE((std::is_same_v<is_char_pointer_t<char const*>, std::true_type>));
+    ASSERT_TRUE((std::is_same_v<is_char_array_t<int[2]>, std::false_type>));
+}
+
 TEST_F(TraitsTest, is_compatible_string_test)
 {
     // clang-format off
@@ -427,6 +470,70 @@ TEST_F(TraitsTest, get_Nth_type_comprehensive_test)
     ASSERT_TRUE((std::is_same_v<Single, char>));
 }
 
+namespace
+{
+template <size_t I> struct PackTag
+{
+};
+
+template <typename IndexSeq> struct LargePack;
+
+template <size_t... Is> struct LargePack<std::index_sequence<Is...>>
+{
+    template <size_t N> using nth          = get_Nth_type_t<N, PackTag<Is>...>;
+    template <size_t N> using nth_overload = util::detail::nth_type_by_overload_t<N, PackTag<Is>...>;
+    template <typename T> static constexpr size_t index_of = index_of_type_v<T, PackTag<Is>...>;
+};
+
+// 1000 elements exceeds the default template depth (900) a recursive implementation would need
+using Pack1000 = LargePack<std::make_index_sequence<1'000>>;
+} // namespace
+
+TEST_F(TraitsTest, get_Nth_type_t_test)
+{
+    ASSERT_TRUE((std::is_same_v<get_Nth_type_t<0, int, double, std::string>, int>));
+    ASSERT_TRUE((std::is_same_v<get_Nth_type_t<1, int, double, std::string>, double>));
+    ASSERT_TRUE((std::is_same_v<get_Nth_type_t<2, int, double, std::string>, std::string>));
+    ASSERT_TRUE((std::is_same_v<get_Nth_type_t<1, int const&, char*&&, void>, char*&&>));
+
+    // portable fallback has to agree with whatever the compiler builtin selects
+    ASSERT_TRUE((std::is_same_v<util::detail::nth_type_by_overload_t<0, int, double>, int>));
+    ASSERT_TRUE((std::is_same_v<util::detail::nth_type_by_overload_t<1, int, double>, double>));
+    ASSERT_TRUE((std::is_same_v<util::detail::nth_type_by_overload_t<2, int, int, int>, int>));
+}
+
+TEST_F(TraitsTest, index_of_type_test)
+{
+    ASSERT_EQ((index_of_type_v<int, int, double, std::string>), 0UL);
+    ASSERT_EQ((index_of_type_v<double, int, double, std::string>), 1UL);
+    ASSERT_EQ((index_of_type_v<std::string, int, double, std::string>), 2UL);
+
+    // first occurrence wins
+    ASSERT_EQ((index_of_type_v<double, int, double, double>), 1UL);
+
+    // not found yields the size of the pack
+    ASSERT_EQ((index_of_type_v<char, int, double, std::string>), 3UL);
+    ASSERT_EQ((index_of_type_v<char>), 0UL);
+
+    // cv-ref qualifications are significant
+    ASSERT_EQ((index_of_type_v<int const, int, int const>), 1UL);
+}
+
+TEST_F(TraitsTest, get_Nth_type_large_pack_test)
+{
+    ASSERT_TRUE((std::is_same_v<Pack1000::nth<0>, PackTag<0>>));
+    ASSERT_TRUE((std::is_same_v<Pack1000::nth<500>, PackTag<500>>));
+    ASSERT_TRUE((std::is_same_v<Pack1000::nth<999>, PackTag<999>>));
+
+    ASSERT_TRUE((std::is_same_v<Pack1000::nth_overload<0>, PackTag<0>>));
+    ASSERT_TRUE((std::is_same_v<Pack1000::nth_overload<999>, PackTag<999>>));
+
+    ASSERT_EQ(Pack1000::index_of<PackTag<0>>, 0UL);
+    ASSERT_EQ(Pack1000::index_of<PackTag<737>>, 737UL);
+    ASSERT_EQ(Pack1000::index_of<PackTag<999>>, 999UL);
+    ASSERT_EQ(Pack1000::index_of<int>, 1'000UL);
+}
+
 TEST_F(TraitsTest, is_string_comprehensive_test)
 {
     // Test all string-like types
@@ -565,6 +672,24 @@ TEST_F(TraitsTest, is_tuple_comprehensive_test)
     ASSERT_FALSE((is_tuple_v<std::array<int, 5>>));
 }
 
+TEST_F(TraitsTest, is_tuple_like_test)
+{
+    ASSERT_TRUE((is_tuple_like_v<std::tuple<>>));
+    ASSERT_TRUE((is_tuple_like_v<std::tuple<int, double>>));
+    ASSERT_TRUE((is_tuple_like_v<std::tuple<int> const>));
+    ASSERT_TRUE((is_tuple_like_v<std::pair<int, double>>));
+    ASSERT_TRUE((is_tuple_like_v<std::array<int, 5>>));
+    ASSERT_TRUE((is_tuple_like_t<std::array<int, 0>>::value));
+
+    ASSERT_FALSE((is_tuple_like_v<int>));
+    ASSERT_FALSE((is_tuple_like_v<std::string>));
+    ASSERT_FALSE((is_tuple_like_v<int[3]>));
+    ASSERT_FALSE((is_tuple_like_v<std::tuple<int>&>));
+
+    static_assert(util::is_tuple_like_c<std::pair<int, int>&>);
+    static_assert(!util::is_tuple_like_c<double>);
+}
+
 TEST_F(TraitsTest, is_equality_comparable_comprehensive_test)
 {
     // Test with various comparable types
@@ -671,6 +796,124 @@ TEST_F(TraitsTest, has_static_member_function_macro_test)
     ASSERT_FALSE((has_static_bool_fill_v<StaticMemberMismatch>));
 }
 
+#if __cplusplus >= 202'002L
+namespace
+{
+struct QualifiedMembers
+{
+    bool fill(int) const noexcept // NOSONAR
+    {
+        return true;
+    }
+
+    bool fill(double) // NOSONAR
+    {
+        return false;
+    }
+
+    static int make(int, char) noexcept
+    {
+        return 0;
+    }
+
+    static int make_throwing(int, char)
+    {
+        return 0;
+    }
+};
+
+struct PrivateMember
+{
+  private:
+    bool fill(int) const noexcept // NOSONAR
+    {
+        return true;
+    }
+};
+
+struct DerivedMembers : QualifiedMembers
+{
+};
+
+DEFINE_HAS_MEMBER_CONCEPT(has_bool_fill_concept, fill, bool())
+DEFINE_HAS_MEMBER_CONCEPT(has_const_noexcept_fill_int, fill, bool(int) const noexcept)
+DEFINE_HAS_MEMBER_CONCEPT(has_const_fill_int, fill, bool(int) const)
+DEFINE_HAS_MEMBER_CONCEPT(has_mutable_fill_int, fill, bool(int))
+DEFINE_HAS_MEMBER_CONCEPT(has_fill_double, fill, bool(double))
+DEFINE_HAS_MEMBER_CONCEPT(has_noexcept_fill_double, fill, bool(double) noexcept)
+DEFINE_HAS_STATIC_MEMBER_CONCEPT(has_static_make, make, int(int, char))
+DEFINE_HAS_STATIC_MEMBER_CONCEPT(has_static_noexcept_make, make, int(int, char) noexcept)
+DEFINE_HAS_STATIC_MEMBER_CONCEPT(has_static_noexcept_make_throwing, make_throwing, int(int, char) noexcept)
+DEFINE_HAS_STATIC_MEMBER_CONCEPT(has_static_bool_fill_concept, fill, bool())
+} // namespace
+
+TEST_F(TraitsTest, has_member_concept_macro_test)
+{
+    // the concepts agree with the class-template traits
+    static_assert(has_bool_fill_concept<MemberMatch> == has_bool_fill_v<MemberMatch>);
+    static_assert(has_bool_fill_concept<MemberMismatch> == has_bool_fill_v<MemberMismatch>);
+    static_assert(has_static_bool_fill_concept<StaticMemberMatch> == has_static_bool_fill_v<StaticMemberMatch>);
+    static_assert(has_static_bool_fill_concept<StaticMemberMismatch> == has_static_bool_fill_v<StaticMemberMismatch>);
+
+    // const and noexcept, picking the matching overload
+    static_assert(has_const_noexcept_fill_int<QualifiedMembers>);
+    static_assert(has_const_fill_int<QualifiedMembers>);
+    static_assert(!has_mutable_fill_int<QualifiedMembers>);
+    static_assert(has_fill_double<QualifiedMembers>);
+    static_assert(!has_noexcept_fill_double<QualifiedMembers>);
+
+    // static members
+    static_assert(has_static_make<QualifiedMembers>);
+    static_assert(has_static_noexcept_make<QualifiedMembers>);
+    static_assert(!has_static_noexcept_make_throwing<QualifiedMembers>);
+    static_assert(!has_static_make<MemberMatch>);
+    static_assert(!has_static_bool_fill_concept<MemberMatch>);
+
+    // inherited, inaccessible and non-class types
+    static_assert(has_const_noexcept_fill_int<DerivedMembers>);
+    static_assert(!has_const_noexcept_fill_int<PrivateMember>);
+    static_assert(!has_const_noexcept_fill_int<int>);
+    static_assert(!has_static_make<std::string>);
+}
+
+namespace
+{
+constexpr auto fill_probe = []<typename T>(auto& target) -> decltype(target = &T::fill) { return target; };
+constexpr auto make_probe = []<typename T>(auto& target) -> decltype(target = &T::make) { return target; };
+constexpr auto make_throwing_probe = []<typename T>(auto& target) -> decltype(target = &T::make_throwing)
+{
+    return target;
+};
+} // namespace
+
+TEST_F(TraitsTest, has_member_function_concept_test)
+{
+    using util::has_member_function_c;
+    using util::has_static_member_function_c;
+
+    // the same answers as the macro concepts
+    static_assert(has_member_function_c<MemberMatch, bool(), fill_probe>);
+    static_assert(!has_member_function_c<MemberMismatch, bool(), fill_probe>);
+    static_assert(has_member_function_c<QualifiedMembers, bool(int) const noexcept, fill_probe>);
+    static_assert(has_member_function_c<QualifiedMembers, bool(int) const, fill_probe>);
+    static_assert(!has_member_function_c<QualifiedMembers, bool(int), fill_probe>);
+    static_assert(has_member_function_c<QualifiedMembers, bool(double), fill_probe>);
+    static_assert(!has_member_function_c<QualifiedMembers, bool(double) noexcept, fill_probe>);
+
+    static_assert(has_static_member_function_c<StaticMemberMatch, bool(), fill_probe>);
+    static_assert(!has_static_member_function_c<StaticMemberMismatch, bool(), fill_probe>);
+    static_assert(has_static_member_function_c<QualifiedMembers, int(int, char), make_probe>);
+    static_assert(has_static_member_function_c<QualifiedMembers, int(int, char) noexcept, make_probe>);
+    static_assert(!has_static_member_function_c<QualifiedMembers, int(int, char) noexcept, make_throwing_probe>);
+    static_assert(!has_static_member_function_c<MemberMatch, bool(), fill_probe>);
+
+    static_assert(has_member_function_c<DerivedMembers, bool(int) const noexcept, fill_probe>);
+    static_assert(!has_member_function_c<PrivateMember, bool(int) const noexcept, fill_probe>);
+    static_assert(!has_member_function_c<int, bool(int) const noexcept, fill_probe>);
+    static_assert(!has_static_member_function_c<std::string, int(int, char), make_probe>);
+}
+#endif
+
 #if __cplusplus >= 202'002L
 TEST_F(TraitsTest, concepts_test)
 {
@@ -0,0 +1,242 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/transcode_tests.cc
+ * Description: tests for bulk and streaming transcoding.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "transcode.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace util;
+
+class TranscodeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    // "a", U+00FC, U+20AC, U+4E2D and U+1F600 in every encoding: 1, 2, 3, 3 and 4 UTF-8 bytes
+    static constexpr string_view    utf8  = "a\xC3\xBC\xE2\x82\xAC\xE4\xB8\xAD\xF0\x9F\x98\x80";
+    static constexpr u16string_view utf16 = u"aü€中\U0001F600";
+    static constexpr u32string_view utf32 = U"aü€中\U0001F600";
+    static constexpr wstring_view   wide  = L"aü€中\U0001F600";
+
+    /**
+     * @brief Text long enough for the vectorised runs, mixing ASCII runs of varying length with the sample above.
+     */
+    template <typename CharT> static basic_string<CharT> long_text(basic_string_view<CharT> sample)
+    {
+        basic_string<CharT> text;
+        for (size_t run = 0; run < 80; run += 7)
+        {
+            text.append(run, CharT{'x'});
+            text.append(sample);
+        }
+        return text;
+    }
+
+    template <typename ToChar, typename FromChar>
+    static void check_conversion(basic_string_view<FromChar> from, basic_string_view<ToChar> expected)
+    {
+        basic_string<ToChar> out;
+        auto const           result = transcode(from, out);
+        ASSERT_TRUE(result);
+        ASSERT_EQ(result.position, from.size());
+        ASSERT_EQ(out, expected);
+
+        basic_string<ToChar> long_out;
+        ASSERT_TRUE(transcode(long_text(from), long_out));
+        ASSERT_EQ(long_out, long_text(expected));
+    }
+
+    /**
+     * @brief Feed the input in two chunks split at every position and compare with the one-shot conversion.
+     */
+    template <typename ToChar, typename FromChar>
+    static void check_streaming(basic_string_view<FromChar> from, basic_string_view<ToChar> expected)
+    {
+        for (size_t split = 0; split <= from.size(); ++split)
+        {
+            transcoder<FromChar, ToChar> stream;
+            basic_string<ToChar>         out;
+            ASSERT_TRUE(stream.feed(from.substr(0, split), out)) << "split=" << split;
+            ASSERT_TRUE(stream.feed(from.substr(split), out)) << "split=" << split;
+            ASSERT_TRUE(stream.finish());
+            ASSERT_EQ(out, expected) << "split=" << split;
+        }
+    }
+};
+
+TEST_F(TranscodeTest, encoding_of_test)
+{
+    ASSERT_EQ(encoding_of_v<char>, unicode_encoding::utf8);
+    ASSERT_EQ(encoding_of_v<char16_t>, unicode_encoding::utf16);
+    ASSERT_EQ(encoding_of_v<char32_t>, unicode_encoding::utf32);
+    ASSERT_EQ(encoding_of_v<wchar_t>, sizeof(wchar_t) == 2 ? unicode_encoding::utf16 : unicode_encoding::utf32);
+}
+
+TEST_F(TranscodeTest, transcode_all_pairs_test)
+{
+    check_conversion<char>(utf8, utf8);
+    check_conversion<char16_t>(utf8, utf16);
+    check_conversion<char32_t>(utf8, utf32);
+    check_conversion<wchar_t>(utf8, wide);
+
+    check_conversion<char>(utf16, utf8);
+    check_conversion<char16_t>(utf16, utf16);
+    check_conversion<char32_t>(utf16, utf32);
+    check_conversion<wchar_t>(utf16, wide);
+
+    check_conversion<char>(utf32, utf8);
+    check_conversion<char16_t>(utf32, utf16);
+    check_conversion<char32_t>(utf32, utf32);
+    check_conversion<wchar_t>(utf32, wide);
+
+    check_conversion<char>(wide, utf8);
+    check_conversion<char16_t>(wide, utf16);
+    check_conversion<char32_t>(wide, utf32);
+}
+
+TEST_F(TranscodeTest, transcode_string_like_test)
+{
+    std::string out = "prefix:";
+    ASSERT_TRUE(transcode(u"abü", out));
+    ASSERT_EQ(out, "prefix:ab\xC3\xBC");
+
+    char16_t const* pointer = u"€";
+    std::string     from_pointer;
+    ASSERT_TRUE(transcode(pointer, from_pointer));
+    ASSERT_EQ(from_pointer, "\xE2\x82\xAC");
+
+    std::u32string from_string;
+    ASSERT_TRUE(transcode(std::string("\xF0\x9F\x98\x80"), from_string));
+    ASSERT_EQ(from_string, U"\U0001F600");
+
+    std::u16string empty;
+    ASSERT_TRUE(transcode(std::string_view{}, empty));
+    ASSERT_TRUE(empty.empty());
+}
+
+TEST_F(TranscodeTest, transcode_invalid_utf8_test)
+{
+    auto check_invalid = [](std::string_view from, size_t position, std::u32string_view converted) {
+        std::u32string out;
+        auto const     result = transcode(from, out);
+        ASSERT_EQ(result.status, transcode_status::invalid) << from.size();
+        ASSERT_EQ(result.position, position);
+        ASSERT_EQ(out, converted);
+    };
+    check_invalid("\x80", 0, U"");                      // lone continuation
+    check_invalid("ab\xC0\x80", 2, U"ab");              // overlong NUL
+    check_invalid("\xE0\x80\x80", 0, U"");              // overlong 3-byte
+    check_invalid("\xED\xA0\x80", 0, U"");              // encoded surrogate
+    check_invalid("\xF4\x90\x80\x80", 0, U"");          // beyond U+10FFFF
+    check_invalid("\xF5\x80\x80\x80", 0, U"");          // invalid lead
+    check_invalid("x\xE2\x82", 1, U"x");                // input ends inside a sequence
+    check_invalid("\xC3\xBC\xE2\x28\xA1", 2, U"ü"); // bad continuation
+}
+
+TEST_F(TranscodeTest, transcode_invalid_utf16_utf32_test)
+{
+    std::string out;
+    auto        result = transcode(std::u16string_view(u"a\xDC00" u"b"), out);
+    ASSERT_EQ(result.status, transcode_status::invalid);
+    ASSERT_EQ(result.position, 1UL);
+    ASSERT_EQ(out, "a");
+
+    out.clear();
+    result = transcode(std::u16string_view(u"ab\xD83D" u"c"), out);
+    ASSERT_EQ(result.status, transcode_status::invalid);
+    ASSERT_EQ(result.position, 2UL);
+
+    out.clear();
+    result = transcode(std::u16string_view(u"ab\xD83D"), out);
+    ASSERT_EQ(result.status, transcode_status::invalid);
+    ASSERT_EQ(result.position, 2UL);
+
+    std::u16string wide_out;
+    char32_t const beyond[] = {U'a', char32_t{0x110000}, 0};
+    result                  = transcode(beyond, wide_out);
+    ASSERT_EQ(result.status, transcode_status::invalid);
+    ASSERT_EQ(result.position, 1UL);
+
+    char32_t const surrogate[] = {char32_t{0xD800}, 0};
+    ASSERT_EQ(transcode(surrogate, wide_out).status, transcode_status::invalid);
+}
+
+TEST_F(TranscodeTest, transcoder_split_test)
+{
+    check_streaming<char16_t>(utf8, utf16);
+    check_streaming<char32_t>(utf8, utf32);
+    check_streaming<char>(utf16, utf8);
+    check_streaming<char32_t>(utf16, utf32);
+    check_streaming<char>(utf32, utf8);
+
+    // one code unit per chunk
+    transcoder<char, char16_t> stream;
+    std::u16string             out;
+    for (char unit : utf8)
+    {
+        ASSERT_TRUE(stream.feed(std::string_view(&unit, 1), out));
+    }
+    ASSERT_EQ(stream.pending(), 0UL);
+    ASSERT_TRUE(stream.finish());
+    ASSERT_EQ(out, utf16);
+}
+
+TEST_F(TranscodeTest, transcoder_error_test)
+{
+    transcoder<char, char32_t> stream;
+    std::u32string             out;
+
+    // a split sequence is kept until the next chunk
+    ASSERT_TRUE(stream.feed(std::string_view("ab\xF0\x9F"), out));
+    ASSERT_EQ(stream.pending(), 2UL);
+    ASSERT_EQ(out, U"ab");
+
+    // input ending inside the sequence
+    auto result = stream.finish();
+    ASSERT_EQ(result.status, transcode_status::truncated);
+    ASSERT_EQ(stream.pending(), 0UL);
+
+    // a sequence that turns out invalid in the next chunk
+    ASSERT_TRUE(stream.feed(std::string_view("\xE2\x82"), out));
+    result = stream.feed(std::string_view("x"), out);
+    ASSERT_EQ(result.status, transcode_status::invalid);
+    ASSERT_EQ(result.position, 0UL);
+    ASSERT_EQ(stream.pending(), 0UL);
+
+    // an invalid sequence inside a chunk
+    result = stream.feed(std::string_view("abc\xFF"), out);
+    ASSERT_EQ(result.status, transcode_status::invalid);
+    ASSERT_EQ(result.position, 3UL);
+}
@@ -0,0 +1,206 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/tuple_algorithms_tests.cc
+ * Description: tests for for_each, transform and fold over tuple-likes.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "tuple_algorithms.h"
+
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+/**
+ * @brief User type opted in to structured bindings with a member get.
+ */
+struct Coordinates
+{
+    int    x;
+    double y;
+
+    template <size_t I> auto const& get() const
+    {
+        if constexpr (I == 0)
+        {
+            return x;
+        }
+        else
+        {
+            return y;
+        }
+    }
+};
+
+/**
+ * @brief User type opted in to structured bindings with a free get found by argument-dependent lookup.
+ */
+struct Span
+{
+    long first;
+    long last;
+};
+
+template <size_t I> long get(Span const& span)
+{
+    return I == 0 ? span.first : span.last;
+}
+} // namespace
+
+template <> struct std::tuple_size<Coordinates> : std::integral_constant<size_t, 2>
+{
+};
+
+template <> struct std::tuple_element<0, Coordinates>
+{
+    using type = int;
+};
+
+template <> struct std::tuple_element<1, Coordinates>
+{
+    using type = double;
+};
+
+template <> struct std::tuple_size<Span> : std::integral_constant<size_t, 2>
+{
+};
+
+template <size_t I> struct std::tuple_element<I, Span>
+{
+    using type = long;
+};
+
+class TupleAlgorithmsTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(TupleAlgorithmsTest, tuple_for_each_test)
+{
+    std::string visited;
+    auto        append = [&visited](auto const& element)
+    {
+        if constexpr (std::is_same_v<std::decay_t<decltype(element)>, std::string>)
+        {
+            visited += element;
+        }
+        else
+        {
+            visited += std::to_string(element);
+        }
+        visited += ',';
+    };
+
+    tuple_for_each(std::tuple{1, std::string("two"), 3L}, append);
+    tuple_for_each(std::pair{4, 5U}, append);
+    tuple_for_each(std::array{6, 7}, append);
+    tuple_for_each(Coordinates{8, 9.5}, append);
+    tuple_for_each(Span{10, 11}, append);
+    tuple_for_each(std::tuple<>{}, append);
+    ASSERT_EQ(visited, "1,two,3,4,5,6,7,8,9.500000,10,11,");
+
+    // elements are passed as lvalues of a mutable tuple
+    std::tuple<int, double> values{1, 2.0};
+    tuple_for_each(values, [](auto& element) { element *= 2; });
+    ASSERT_EQ(values, (std::tuple<int, double>{2, 4.0}));
+
+    // and moved from a temporary
+    std::vector<std::unique_ptr<int>> owned;
+    tuple_for_each(std::tuple{std::make_unique<int>(1), std::make_unique<int>(2)},
+                   [&owned](std::unique_ptr<int>&& element) { owned.push_back(std::move(element)); });
+    ASSERT_EQ(owned.size(), 2UL);
+    ASSERT_EQ(*owned[1], 2);
+}
+
+TEST_F(TupleAlgorithmsTest, tuple_transform_test)
+{
+    auto const sizes = tuple_transform(std::tuple{std::string_view("ab"), std::string("cde"), std::vector<int>(4)},
+                                       [](auto const& element) { return std::size(element); });
+    static_assert(std::is_same_v<std::remove_const_t<decltype(sizes)>, std::tuple<size_t, size_t, size_t>>);
+    ASSERT_EQ(sizes, (std::tuple<size_t, size_t, size_t>{2, 3, 4}));
+
+    auto const doubled = tuple_transform(std::pair{1, 2.5}, [](auto element) { return element * 2; });
+    ASSERT_EQ(doubled, (std::tuple<int, double>{2, 5.0}));
+
+    // calls are made in order
+    int  counter = 0;
+    auto order   = tuple_transform(std::array{0, 0, 0}, [&counter](int) { return counter++; });
+    ASSERT_EQ(order, (std::tuple<int, int, int>{0, 1, 2}));
+
+    // references are kept
+    std::tuple<int, int> target{1, 2};
+    auto                 refs = tuple_transform(target, [](int& element) -> int& { return element; });
+    std::get<1>(refs)         = 20;
+    ASSERT_EQ(std::get<1>(target), 20);
+
+    ASSERT_EQ(tuple_transform(Coordinates{3, 0.5}, [](auto element) { return element + 1; }),
+              (std::tuple<int, double>{4, 1.5}));
+    ASSERT_EQ(tuple_transform(std::tuple<>{}, [](auto element) { return element; }), std::tuple<>{});
+}
+
+TEST_F(TupleAlgorithmsTest, tuple_fold_test)
+{
+    auto const plus = [](auto acc, auto element) { return acc + element; };
+
+    ASSERT_EQ(tuple_fold(std::tuple{1, 2.5, 3L}, 0.0, plus), 6.5);
+    ASSERT_EQ(tuple_fold(std::array{1, 2, 3, 4}, 0, plus), 10);
+    ASSERT_EQ(tuple_fold(Span{5, 7}, 0L, plus), 12L);
+    ASSERT_EQ(tuple_fold(std::tuple<>{}, 42, plus), 42);
+
+    // left fold, with an accumulator changing type
+    auto const joined = tuple_fold(std::tuple{1, 'b', std::string("c")}, std::string("a"),
+                                   [](std::string acc, auto const& element)
+                                   {
+                                       if constexpr (std::is_same_v<std::decay_t<decltype(element)>, int>)
+                                       {
+                                           return acc + std::to_string(element);
+                                       }
+                                       else
+                                       {
+                                           return acc + element;
+                                       }
+                                   });
+    ASSERT_EQ(joined, "a1bc");
+    ASSERT_EQ(tuple_fold(std::pair{3, 4}, std::tuple<>{}, [](auto acc, int element)
+                         { return std::tuple_cat(acc, std::tuple{element}); }),
+              (std::tuple<int, int>{3, 4}));
+
+    static_assert(tuple_fold(std::tuple{1, 2, 3}, 0, [](int acc, int element) { return acc * 10 + element; }) == 123);
+}
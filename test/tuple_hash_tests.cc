@@ -0,0 +1,154 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/tuple_hash_tests.cc
+ * Description: tests for tuple_hash, util::hash and has_std_hash with a hasher.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+
+#include "tuple_hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+struct NoHash
+{
+};
+
+using Key = tuple<string, int, int>;
+} // namespace
+
+class TupleHashTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(TupleHashTest, has_std_hash_with_hasher_test)
+{
+    // std::hash has no specialisation for tuples, util::hash has
+    ASSERT_FALSE((has_std_hash_v<Key>));
+    ASSERT_TRUE((has_std_hash_v<Key, util::hash<Key>>));
+    ASSERT_TRUE((has_std_hash_v<pair<string, double>, util::hash<pair<string, double>>>));
+    ASSERT_TRUE((has_std_hash_v<tuple<>, util::hash<tuple<>>>));
+    using Nested = tuple<pair<int, string>, tuple<char>>;
+    ASSERT_TRUE((has_std_hash_v<Nested, util::hash<Nested>>));
+
+    // util::hash is std::hash for everything else
+    ASSERT_TRUE((has_std_hash_v<string, util::hash<string>>));
+    ASSERT_TRUE((has_std_hash_v<int, util::hash<int>>));
+    ASSERT_FALSE((has_std_hash_v<NoHash, util::hash<NoHash>>));
+    ASSERT_FALSE((has_std_hash_v<void, util::hash<void>>));
+
+    // a single element without hash disqualifies the composite
+    ASSERT_FALSE((has_std_hash_v<tuple<int, NoHash>, util::hash<tuple<int, NoHash>>>));
+    ASSERT_FALSE((has_std_hash_v<pair<NoHash, int>, util::hash<pair<NoHash, int>>>));
+    ASSERT_FALSE((has_std_hash_v<tuple<tuple<NoHash>>, util::hash<tuple<tuple<NoHash>>>>));
+
+    ASSERT_TRUE((tuple_hashable_c<Key>));
+    ASSERT_TRUE((tuple_hashable_c<pair<int, int>>));
+    ASSERT_FALSE((tuple_hashable_c<tuple<vector<int>>>));
+    ASSERT_FALSE((tuple_hashable_c<int>));
+    ASSERT_FALSE((tuple_hashable_c<string>));
+}
+
+TEST_F(TupleHashTest, tuple_hash_test)
+{
+    tuple_hash<Key> const hasher;
+
+    ASSERT_EQ(hasher(Key{"eth0", 10, 24}), hasher(Key{"eth0", 10, 24}));
+    ASSERT_EQ(hasher(Key{"eth0", 10, 24}), util::hash<Key>{}(Key{"eth0", 10, 24}));
+    ASSERT_NE(hasher(Key{"eth0", 10, 24}), hasher(Key{"eth0", 24, 10}));
+    ASSERT_NE(hasher(Key{"eth0", 10, 24}), hasher(Key{"eth1", 10, 24}));
+    ASSERT_NE(hasher(Key{"eth0", 0, 0}), hasher(Key{"eth0", 1, 1}));
+    ASSERT_TRUE(noexcept(hasher(Key{})));
+
+    // pairs and tuples of the same elements hash alike
+    ASSERT_EQ((tuple_hash<pair<int, string>>{}({1, "one"})), (tuple_hash<tuple<int, string>>{}({1, "one"})));
+
+    // nested composites
+    using Nested = tuple<pair<int, int>, tuple<string>>;
+    ASSERT_NE((tuple_hash<Nested>{}({{1, 2}, {"x"}})), (tuple_hash<Nested>{}({{2, 1}, {"x"}})));
+}
+
+TEST_F(TupleHashTest, tuple_hash_distribution_test)
+{
+    // identity hashed integers of a small range: all hashes distinct, and their low bits, which pick the bucket of a
+    // power-of-two table, close to uniform
+    constexpr int                          range   = 64;
+    constexpr size_t                       buckets = 1 << 12;
+    unordered_set<size_t>                  hashes;
+    vector<size_t>                         per_bucket(buckets);
+    tuple_hash<tuple<int, int, int>> const hasher;
+    for (int i = 0; i < range; ++i)
+    {
+        for (int j = 0; j < range; ++j)
+        {
+            for (int k = 0; k < range; ++k)
+            {
+                auto const hash = hasher({i, j, k});
+                hashes.insert(hash);
+                ++per_bucket[hash & (buckets - 1)];
+            }
+        }
+    }
+    ASSERT_EQ(hashes.size(), size_t{range * range * range});
+    // 64 keys per bucket on average
+    for (size_t count : per_bucket)
+    {
+        ASSERT_GT(count, 20UL);
+        ASSERT_LT(count, 120UL);
+    }
+}
+
+TEST_F(TupleHashTest, unordered_map_test)
+{
+    unordered_map<Key, int, util::hash<Key>> routes;
+    for (int prefix = 0; prefix <= 32; ++prefix)
+    {
+        routes[{"eth" + to_string(prefix % 4), prefix, 32 - prefix}] = prefix;
+    }
+    ASSERT_EQ(routes.size(), 33UL);
+    ASSERT_EQ((routes.at({"eth1", 5, 27})), 5);
+    ASSERT_EQ(routes.count({"eth1", 27, 5}), 0UL);
+
+    unordered_set<pair<string, string>, tuple_hash<pair<string, string>>> links{{"a", "b"}, {"b", "a"}, {"a", "b"}};
+    ASSERT_EQ(links.size(), 2UL);
+}
@@ -0,0 +1,164 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/type_list_tests.cc
+ * Description: tests for type lists and their algorithms.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "type_list.h"
+
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+template <size_t I> struct Message
+{
+    char payload[I + 1];
+};
+
+template <size_t... Is> auto make_messages(std::index_sequence<Is...>) -> type_list<Message<Is>...>;
+
+template <size_t N> using messages_t = decltype(make_messages(std::make_index_sequence<N>{}));
+
+template <size_t... Is> auto make_repeated_messages(std::index_sequence<Is...>) -> type_list<Message<Is % 8>...>;
+
+// longer than the list type_list_unique deduplicates in the constant evaluator
+template <size_t N> using repeated_messages_t = decltype(make_repeated_messages(std::make_index_sequence<N>{}));
+
+template <typename T> struct is_even_message : std::bool_constant<sizeof(T) % 2 == 0>
+{
+};
+} // namespace
+
+class TypeListTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(TypeListTest, type_list_members_test)
+{
+    using list = type_list<int, double, std::string, int>;
+
+    static_assert(list::size == 4);
+    static_assert(type_list<>::size == 0);
+    static_assert(std::is_same_v<list::at<2>, std::string>);
+    static_assert(list::contains<double>);
+    static_assert(!list::contains<float>);
+    static_assert(!type_list<>::contains<int>);
+    static_assert(list::index_of<int> == 0);
+    static_assert(list::index_of<std::string> == 2);
+    static_assert(list::index_of<float> == list::size);
+    static_assert(std::is_same_v<list::apply<std::tuple>, std::tuple<int, double, std::string, int>>);
+    static_assert(std::is_same_v<type_list<int, char>::apply<std::variant>, std::variant<int, char>>);
+
+    static_assert(type_list_contains_v<list, std::string>);
+    static_assert(type_list_index_of_v<list, double> == 1);
+    static_assert(is_type_list_v<list>);
+    static_assert(is_type_list_t<type_list<>>::value);
+    static_assert(!is_type_list_v<std::tuple<int>>);
+    static_assert(std::is_same_v<type_list_from_tuple_t<std::tuple<int, char>>, type_list<int, char>>);
+}
+
+TEST_F(TypeListTest, type_list_concat_test)
+{
+    static_assert(std::is_same_v<type_list_concat_t<>, type_list<>>);
+    static_assert(std::is_same_v<type_list_concat_t<type_list<int>>, type_list<int>>);
+    static_assert(std::is_same_v<type_list_concat_t<type_list<int, char>, type_list<>, type_list<double>>,
+                                 type_list<int, char, double>>);
+    static_assert(std::is_same_v<type_list_concat_t<type_list<int>, type_list<int>>, type_list<int, int>>);
+}
+
+TEST_F(TypeListTest, type_list_transform_test)
+{
+    static_assert(std::is_same_v<type_list_transform_t<type_list<int, char const>, std::add_pointer_t>,
+                                 type_list<int*, char const*>>);
+    static_assert(std::is_same_v<type_list_transform_t<type_list<int const&, double>, std::remove_cvref_t>,
+                                 type_list<int, double>>);
+    static_assert(std::is_same_v<type_list_transform_t<type_list<>, std::add_pointer_t>, type_list<>>);
+}
+
+TEST_F(TypeListTest, type_list_filter_test)
+{
+    using list = type_list<int, double, char, std::string, long>;
+
+    static_assert(std::is_same_v<type_list_filter_t<list, std::is_integral>, type_list<int, char, long>>);
+    static_assert(std::is_same_v<type_list_filter_t<list, std::is_class>, type_list<std::string>>);
+    static_assert(std::is_same_v<type_list_filter_t<list, std::is_void>, type_list<>>);
+    static_assert(std::is_same_v<type_list_filter_t<type_list<>, std::is_integral>, type_list<>>);
+
+    using filtered = type_list_filter_t<messages_t<10>, is_even_message>;
+    static_assert(filtered::size == 5);
+    static_assert(std::is_same_v<filtered::at<0>, Message<1>>);
+    static_assert(std::is_same_v<filtered::at<4>, Message<9>>);
+}
+
+TEST_F(TypeListTest, type_list_unique_test)
+{
+    static_assert(std::is_same_v<type_list_unique_t<type_list<int, char, int, double, char>>,
+                                 type_list<int, char, double>>);
+    static_assert(std::is_same_v<type_list_unique_t<type_list<int, int const, int&>>, type_list<int, int const, int&>>);
+    static_assert(std::is_same_v<type_list_unique_t<type_list<>>, type_list<>>);
+    static_assert(std::is_same_v<type_list_unique_t<messages_t<50>>, messages_t<50>>);
+
+    using doubled = type_list_concat_t<messages_t<20>, messages_t<20>>;
+    static_assert(std::is_same_v<type_list_unique_t<doubled>, messages_t<20>>);
+    static_assert(std::is_same_v<type_list_unique_t<repeated_messages_t<8>>, messages_t<8>>);
+    static_assert(std::is_same_v<type_list_unique_t<repeated_messages_t<1100>>, messages_t<8>>);
+}
+
+TEST_F(TypeListTest, type_list_sort_by_test)
+{
+    using list = type_list<char, double, int16_t, int32_t, uint8_t>;
+
+    static_assert(std::is_same_v<type_list_sort_by_t<list, size_of>,
+                                 type_list<char, uint8_t, int16_t, int32_t, double>>);
+    static_assert(std::is_same_v<type_list_sort_by_t<list, align_of, std::greater<>>,
+                                 type_list<double, int32_t, int16_t, char, uint8_t>>);
+    static_assert(std::is_same_v<type_list_sort_by_t<type_list<>, size_of>, type_list<>>);
+    static_assert(std::is_same_v<type_list_sort_by_t<type_list<int>, size_of>, type_list<int>>);
+
+    // equal keys keep their order across merged runs
+    static_assert(
+        std::is_same_v<type_list_sort_by_t<type_list<int32_t, char, uint32_t, uint8_t, float, int8_t, bool>, size_of>,
+                       type_list<char, uint8_t, int8_t, bool, int32_t, uint32_t, float>>);
+
+    using reversed = type_list_sort_by_t<messages_t<30>, size_of, std::greater<>>;
+    static_assert(std::is_same_v<reversed::at<0>, Message<29>>);
+    static_assert(std::is_same_v<reversed::at<29>, Message<0>>);
+}
@@ -0,0 +1,130 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/type_name_tests.cc
+ * Description: tests for type_name and type_id.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "type_name.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace ns
+{
+struct Foo
+{
+};
+
+template <typename T> struct Bar
+{
+};
+} // namespace ns
+
+namespace
+{
+template <int> struct numbered
+{
+};
+
+template <int... Is> type_list<numbered<Is>...> make_numbered_list(std::integer_sequence<int, Is...>);
+} // namespace
+
+class TypeNameTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(TypeNameTest, type_name_test)
+{
+    static_assert(type_name<int>() == "int");
+
+    ASSERT_EQ(type_name<void>(), "void");
+    ASSERT_EQ(type_name<double>(), "double");
+#if defined(__GNUC__) || defined(__clang__)
+    ASSERT_EQ(type_name<ns::Foo>(), "ns::Foo");
+    ASSERT_EQ(type_name<ns::Bar<int>>(), "ns::Bar<int>");
+    ASSERT_EQ(type_name<int const*>(), "const int*");
+#endif
+    ASSERT_NE(type_name<ns::Foo>().find("Foo"), std::string_view::npos);
+    ASSERT_NE(type_name<std::vector<ns::Foo>>().find("vector"), std::string_view::npos);
+    ASSERT_NE(type_name<int&>(), type_name<int>());
+}
+
+TEST_F(TypeNameTest, type_id_test)
+{
+    static_assert(type_id<int>() == type_id_v<int>);
+    static_assert(type_id_v<int> != type_id_v<unsigned>);
+
+    ASSERT_EQ(type_id<ns::Foo>(), detail::fnv1a(type_name<ns::Foo>()));
+    ASSERT_NE(type_id_v<ns::Foo>, type_id_v<ns::Foo const>);
+    ASSERT_NE(type_id_v<ns::Bar<int>>, type_id_v<ns::Bar<long>>);
+    ASSERT_EQ(type_id_v<std::remove_cvref_t<ns::Foo const&>>, type_id_v<ns::Foo>);
+}
+
+TEST_F(TypeNameTest, type_ids_test)
+{
+    using ids = std::remove_cvref_t<decltype(type_ids_v<int, ns::Foo, char>)>;
+    static_assert(std::is_same_v<ids, std::array<uint64_t, 3>>);
+    static_assert(type_ids_v<>.empty());
+
+    ASSERT_EQ((type_ids_v<int, ns::Foo, char>[0]), (type_id_v<get_Nth_type_t<0, int, ns::Foo, char>>));
+    ASSERT_EQ((type_ids_v<int, ns::Foo, char>[1]), (type_id_v<get_Nth_type_t<1, int, ns::Foo, char>>));
+    ASSERT_EQ((type_ids_v<int, ns::Foo, char>[2]), type_id_v<char>);
+}
+
+TEST_F(TypeNameTest, has_distinct_type_ids_test)
+{
+    ASSERT_TRUE((has_distinct_type_ids_v<type_list<>>));
+    ASSERT_TRUE((has_distinct_type_ids_v<type_list<int, long, ns::Foo>>));
+    ASSERT_TRUE((has_distinct_type_ids_v<type_list<int, long, int>>)); // repeated types are not collisions
+    ASSERT_TRUE((std::is_same_v<has_distinct_type_ids_t<type_list<int>>, std::true_type>));
+
+    using numbered_list = decltype(make_numbered_list(std::make_integer_sequence<int, 500>{}));
+    ASSERT_TRUE(has_distinct_type_ids_v<numbered_list>);
+}
+
+TEST_F(TypeNameTest, registry_test)
+{
+    std::unordered_map<uint64_t, std::string_view> registry;
+    registry.emplace(type_id_v<ns::Foo>, "foo handler");
+    registry.emplace(type_id_v<ns::Bar<int>>, "bar handler");
+
+    ASSERT_EQ(registry.at(type_id<ns::Foo>()), "foo handler");
+    ASSERT_EQ(registry.at(type_id<ns::Bar<int>>()), "bar handler");
+    ASSERT_FALSE(registry.contains(type_id<ns::Bar<char>>()));
+}
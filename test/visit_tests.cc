@@ -0,0 +1,275 @@
+/*
+ * Repository:  https://github.com/kingkybel/TypeTraits
+ * File Name:   test/visit_tests.cc
+ * Description: tests for visit and visit_indexed.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-17
+ * @author: Dieter J Kybelksties
+ */
+#include "visit.h"
+
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+template <size_t I> struct alternative
+{
+    size_t value;
+};
+
+template <typename Indices> struct variant_over;
+
+template <size_t... Is> struct variant_over<std::index_sequence<Is...>>
+{
+    using type = std::variant<alternative<Is>...>;
+};
+
+template <size_t N> using variant_of = typename variant_over<std::make_index_sequence<N>>::type;
+
+template <typename Variant, typename T> struct variant_append;
+
+template <typename... Ts, typename T> struct variant_append<std::variant<Ts...>, T>
+{
+    using type = std::variant<Ts..., T>;
+};
+
+/**
+ * @brief Variant holding alternative index, with the given value.
+ */
+template <size_t N> variant_of<N> make_variant(size_t index, size_t value)
+{
+    static constexpr auto makers = []<size_t... Is>(std::index_sequence<Is...>)
+    {
+        return std::array<variant_of<N> (*)(size_t), N>{
+            [](size_t held) { return variant_of<N>{std::in_place_index<Is>, alternative<Is>{held}}; }...};
+    }(std::make_index_sequence<N>{});
+    return makers[index](value);
+}
+
+/**
+ * @brief Throws when copied, to make a variant valueless.
+ */
+struct throws_on_copy
+{
+    throws_on_copy() = default;
+
+    throws_on_copy(throws_on_copy const&)
+    {
+        throw std::runtime_error("copy");
+    }
+
+    throws_on_copy& operator=(throws_on_copy const&) = default;
+};
+
+/**
+ * @brief Reports the value category and constness of its argument.
+ */
+struct category
+{
+    template <typename T> std::string operator()(T&&) const
+    {
+        std::string const constness = std::is_const_v<std::remove_reference_t<T>> ? "const " : "";
+        return constness + (std::is_lvalue_reference_v<T> ? "lvalue" : "rvalue");
+    }
+};
+} // namespace
+
+class VisitTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(VisitTest, visit_indexed_single_variant_test)
+{
+    std::variant<int, std::string, double> value = std::string("hello");
+    auto const size = [](auto index, auto const& held) { return index() * 100 + sizeof(held); };
+
+    ASSERT_EQ(util::visit_indexed(size, value), 100 + sizeof(std::string));
+    value = 2.5;
+    ASSERT_EQ(util::visit_indexed(size, value), 200 + sizeof(double));
+    ASSERT_EQ(util::visit_indexed([](auto, auto const& held) { return std::to_string(held).substr(0, 3); },
+                                  std::variant<int, double>{2.5}),
+              "2.5");
+
+    util::visit_indexed([](auto, auto& held) { held = {}; }, value);
+    ASSERT_EQ(std::get<double>(value), 0.0);
+
+    constexpr std::variant<int, char> constant = 'x';
+    static_assert(util::visit_indexed([](auto, auto held) { return static_cast<int>(held); }, constant) == 'x');
+}
+
+TEST_F(VisitTest, value_category_test)
+{
+    std::variant<int, std::string>       value    = 1;
+    std::variant<int, std::string> const constant = 1;
+    auto const categorise = [](auto, auto&& held) { return category{}(std::forward<decltype(held)>(held)); };
+
+    ASSERT_EQ(util::visit_indexed(categorise, value), "lvalue");
+    ASSERT_EQ(util::visit_indexed(categorise, constant), "const lvalue");
+    ASSERT_EQ(util::visit_indexed(categorise, std::move(value)), "rvalue");
+    ASSERT_EQ(util::visit_indexed(categorise, std::move(constant)), "const rvalue");
+
+    std::variant<int, std::unique_ptr<int>> owner = std::make_unique<int>(7);
+    auto const taken = util::visit_indexed(
+        [](auto index, auto&& held) -> std::unique_ptr<int>
+        {
+            if constexpr (index() == 1)
+            {
+                return std::move(held);
+            }
+            else
+            {
+                return nullptr;
+            }
+        },
+        std::move(owner)
+    );
+    ASSERT_EQ(*taken, 7);
+}
+
+TEST_F(VisitTest, multiple_variants_test)
+{
+    std::variant<int, std::string, double> first  = std::string("abc");
+    std::variant<char, long>               second = 5L;
+    auto const sizes = [](auto, auto, auto const& lhs, auto const& rhs) { return sizeof(lhs) * 100 + sizeof(rhs); };
+
+    ASSERT_EQ(util::visit_indexed(sizes, first, second), sizeof(std::string) * 100 + sizeof(long));
+    first  = 1;
+    second = 'c';
+    ASSERT_EQ(util::visit_indexed(sizes, first, second), sizeof(int) * 100 + sizeof(char));
+    ASSERT_EQ(util::visit_indexed([](auto, auto, auto, auto, auto, auto) { return 3; }, first, second, first), 3);
+
+    // every combination of 16 x 16 alternatives
+    for (size_t left = 0; left < 16; ++left)
+    {
+        for (size_t right = 0; right < 16; ++right)
+        {
+            auto const combination = util::visit_indexed(
+                [](auto lhs_index, auto rhs_index, auto const& lhs, auto const& rhs)
+                { return (lhs_index() * 16 + rhs_index()) * 100 + lhs.value * 10 + rhs.value; },
+                make_variant<16>(left, 1),
+                make_variant<16>(right, 2)
+            );
+            ASSERT_EQ(combination, (left * 16 + right) * 100 + 12);
+        }
+    }
+}
+
+TEST_F(VisitTest, visit_indexed_test)
+{
+    std::variant<int, int, std::string> value{std::in_place_index<1>, 7};
+
+    ASSERT_EQ(util::visit_indexed(
+                  [](auto index, auto const& held) -> size_t
+                  {
+                      if constexpr (index() == 2)
+                      {
+                          return held.size();
+                      }
+                      else
+                      {
+                          return index() * 100 + static_cast<size_t>(held);
+                      }
+                  },
+                  value
+              ),
+              107UL);
+
+    std::variant<char, long> other = 'x';
+    auto const combine = [](auto first, auto second, auto const&, auto const&) { return first() * 10 + second(); };
+    ASSERT_EQ(util::visit_indexed(combine, value, other), 10UL);
+}
+
+TEST_F(VisitTest, many_alternatives_test)
+{
+    variant_of<256> value{std::in_place_index<200>, alternative<200>{3}};
+    auto const      combine = []<size_t I>(auto, alternative<I> const& held) { return I * 1000 + held.value; };
+
+    ASSERT_EQ(util::visit_indexed(combine, value), 200'003UL);
+    value.emplace<255>(alternative<255>{1});
+    ASSERT_EQ(util::visit_indexed(combine, value), 255'001UL);
+
+    // 20 x 20 combinations exceed the switch and take the table of function pointers
+    variant_of<20> lhs{std::in_place_index<19>, alternative<19>{1}};
+    variant_of<20> rhs{std::in_place_index<7>, alternative<7>{2}};
+    ASSERT_EQ(util::visit_indexed([](auto left, auto right, auto const&, auto const&) { return left() * 20 + right(); },
+                                  lhs,
+                                  rhs),
+              19UL * 20 + 7);
+}
+
+TEST_F(VisitTest, valueless_test)
+{
+    std::variant<int, throws_on_copy> value = 1;
+    try
+    {
+        throws_on_copy const source;
+        value = source;
+    }
+    catch (std::runtime_error const&)
+    {
+        // just in case
+    }
+    ASSERT_TRUE(value.valueless_by_exception());
+    ASSERT_THROW(util::visit_indexed([](auto, auto const&) { return 0; }, value), std::bad_variant_access);
+
+    // a valueless variant with more alternatives than the switch has cases, dispatched by the table
+    typename variant_append<variant_of<20>, throws_on_copy>::type many = alternative<0>{1};
+    try
+    {
+        throws_on_copy const source;
+        many = source;
+    }
+    catch (std::runtime_error const&)
+    {
+        // just in case
+    }
+    ASSERT_TRUE(many.valueless_by_exception());
+    ASSERT_THROW(util::visit_indexed([](auto, auto const&) { return 0; }, many), std::bad_variant_access);
+
+    // a valueless variant among several
+    std::variant<char, long> other = 'c';
+    ASSERT_THROW(util::visit_indexed([](auto, auto, auto const&, auto const&) { return 0; }, other, value),
+                 std::bad_variant_access);
+    // and by the table, which has throwing entries for a valueless variant in any position
+    ASSERT_THROW(util::visit_indexed([](auto, auto, auto const&, auto const&) { return 0; }, other, many),
+                 std::bad_variant_access);
+    ASSERT_THROW(util::visit_indexed([](auto, auto, auto const&, auto const&) { return 0; }, many, other),
+                 std::bad_variant_access);
+}